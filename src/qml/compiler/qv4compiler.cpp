@@ -396,6 +396,8 @@ void QV4::Compiler::JSUnitGenerator::writeFunction(char *f, QV4::Compiler::Conte
         function->flags |= CompiledData::Function::IsGenerator;
     if (irFunction->returnsClosure)
         function->flags |= CompiledData::Function::IsClosureWrapper;
+    if (!irFunction->hasDynamicDependencies)
+        function->flags |= CompiledData::Function::HasStaticDependencies;
 
     if (!irFunction->returnsClosure
             || irFunction->innerFunctionAccessesThis
@@ -276,9 +276,20 @@ bool ScanFunctions::visit(ImportDeclaration *declaration)
     return false;
 }
 
+void ScanFunctions::markDynamicDependencies()
+{
+    // Anything that can branch or run other code means that the set of QML properties a
+    // binding depends on may differ from one evaluation to the next.
+    Context *c = _context;
+    while (c->contextType == ContextType::Block)
+        c = c->parent;
+    c->hasDynamicDependencies = true;
+}
+
 bool ScanFunctions::visit(CallExpression *ast)
 {
     Q_ASSERT(_context);
+    markDynamicDependencies();
     if (!_context->hasDirectEval) {
         if (IdentifierExpression *id = cast<IdentifierExpression *>(ast->base)) {
             if (id->name == QLatin1String("eval")) {
@@ -291,6 +302,92 @@ bool ScanFunctions::visit(CallExpression *ast)
     return true;
 }
 
+bool ScanFunctions::visit(NewExpression *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(NewMemberExpression *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(TaggedTemplate *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(ConditionalExpression *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(BinaryExpression *ast)
+{
+    Q_ASSERT(_context);
+    switch (ast->op) {
+    case QSOperator::And:
+    case QSOperator::Or:
+    case QSOperator::Coalesce:
+        markDynamicDependencies();
+        break;
+    default:
+        break;
+    }
+    return true;
+}
+
+bool ScanFunctions::visit(ArrayMemberExpression *ast)
+{
+    Q_ASSERT(_context);
+    if (ast->isOptional)
+        markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(YieldExpression *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(IfStatement *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(WhileStatement *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(SwitchStatement *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
+bool ScanFunctions::visit(TryStatement *)
+{
+    Q_ASSERT(_context);
+    markDynamicDependencies();
+    return true;
+}
+
 bool ScanFunctions::visit(PatternElement *ast)
 {
     Q_ASSERT(_context);
@@ -451,6 +548,9 @@ bool ScanFunctions::visit(FieldMemberExpression *ast)
         }
     }
 
+    if (ast->isOptional)
+        markDynamicDependencies();
+
     return true;
 }
 
@@ -511,6 +611,7 @@ void ScanFunctions::endVisit(FunctionDeclaration *)
 }
 
 bool ScanFunctions::visit(DoWhileStatement *ast) {
+    markDynamicDependencies();
     {
         TemporaryBoolAssignment allowFuncDecls(_allowFuncDecls, !_context->isStrict);
         Node::accept(ast->statement, this);
@@ -520,6 +621,7 @@ bool ScanFunctions::visit(DoWhileStatement *ast) {
 }
 
 bool ScanFunctions::visit(ForStatement *ast) {
+    markDynamicDependencies();
     enterEnvironment(ast, ContextType::Block, QStringLiteral("%For"));
     Node::accept(ast->initialiser, this);
     Node::accept(ast->declarations, this);
@@ -539,6 +641,7 @@ void ScanFunctions::endVisit(ForStatement *)
 
 bool ScanFunctions::visit(ForEachStatement *ast)
 {
+    markDynamicDependencies();
     enterEnvironment(ast, ContextType::Block, QStringLiteral("%Foreach"));
     if (ast->expression) {
         Q_ASSERT(_context);
@@ -79,6 +79,7 @@ protected:
     void checkDirectivePrologue(QQmlJS::AST::StatementList *ast);
 
     void checkName(QStringView name, const QQmlJS::SourceLocation &loc);
+    void markDynamicDependencies();
 
     bool visit(QQmlJS::AST::Program *ast) override;
     void endVisit(QQmlJS::AST::Program *) override;
@@ -90,6 +91,17 @@ protected:
     bool visit(QQmlJS::AST::ImportDeclaration *declaration) override;
 
     bool visit(QQmlJS::AST::CallExpression *ast) override;
+    bool visit(QQmlJS::AST::NewExpression *) override;
+    bool visit(QQmlJS::AST::NewMemberExpression *) override;
+    bool visit(QQmlJS::AST::TaggedTemplate *) override;
+    bool visit(QQmlJS::AST::ConditionalExpression *) override;
+    bool visit(QQmlJS::AST::BinaryExpression *ast) override;
+    bool visit(QQmlJS::AST::ArrayMemberExpression *ast) override;
+    bool visit(QQmlJS::AST::YieldExpression *) override;
+    bool visit(QQmlJS::AST::IfStatement *) override;
+    bool visit(QQmlJS::AST::WhileStatement *) override;
+    bool visit(QQmlJS::AST::SwitchStatement *) override;
+    bool visit(QQmlJS::AST::TryStatement *) override;
     bool visit(QQmlJS::AST::PatternElement *ast) override;
     bool visit(QQmlJS::AST::IdentifierExpression *ast) override;
     bool visit(QQmlJS::AST::ExpressionStatement *ast) override;
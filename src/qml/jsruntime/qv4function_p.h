@@ -105,6 +105,7 @@ public:
     inline bool isArrowFunction() const { return compiledFunction->flags & CompiledData::Function::IsArrowFunction; }
     inline bool isGenerator() const { return compiledFunction->flags & CompiledData::Function::IsGenerator; }
     inline bool isClosureWrapper() const { return compiledFunction->flags & CompiledData::Function::IsClosureWrapper; }
+    inline bool hasStaticDependencies() const { return compiledFunction->flags & CompiledData::Function::HasStaticDependencies; }
 
     QQmlSourceLocation sourceLocation() const;
 
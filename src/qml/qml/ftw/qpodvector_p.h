@@ -111,6 +111,10 @@ public:
         return m_count;
     }
 
+    int capacity() const {
+        return m_capacity;
+    }
+
     void copyAndClear(QPODVector<T,Increment> &other) {
         if (other.m_data) ::free(other.m_data);
         other.m_count = m_count;
@@ -1018,11 +1018,11 @@ void QQmlComponentPrivate::beginDeferred(QQmlEnginePrivate *enginePriv,
                                                  QObject *object, DeferredState *deferredState)
 {
     QQmlData *ddata = QQmlData::get(object);
-    Q_ASSERT(!ddata->deferredData.isEmpty());
+    Q_ASSERT(ddata->hasDeferredData());
 
-    deferredState->reserve(ddata->deferredData.size());
+    deferredState->reserve(ddata->deferredData().size());
 
-    for (QQmlData::DeferredData *deferredData : std::as_const(ddata->deferredData)) {
+    for (QQmlData::DeferredData *deferredData : ddata->deferredData()) {
         enginePriv->inProgressCreations++;
 
         ConstructionState state;
@@ -149,7 +149,9 @@ public:
 
     QQmlAbstractBinding *bindings;
     QQmlBoundSignal *signalHandlers;
-    std::vector<QQmlPropertyObserver> propertyObservers;
+
+    // Rarely used, allocated on demand in the extended data
+    std::vector<QQmlPropertyObserver> &propertyObservers();
 
     // Linked list for QQmlContext::contextObjects
     QQmlData *nextContextObject;
@@ -182,7 +184,10 @@ public:
         Q_DISABLE_COPY(DeferredData);
     };
     QQmlRefPointer<QV4::ExecutableCompilationUnit> compilationUnit;
-    QVector<DeferredData *> deferredData;
+
+    // Rarely used, allocated on demand in the extended data
+    bool hasDeferredData() const;
+    const QVector<DeferredData *> &deferredData() const;
 
     void deferData(int objectIndex, const QQmlRefPointer<QV4::ExecutableCompilationUnit> &,
                    const QQmlRefPointer<QQmlContextData> &);
@@ -255,13 +260,34 @@ public:
         return createPropertyCache(object);
     }
 
+    // Heap used for the QML bookkeeping of objects, as reported by memoryUsage()
+    struct MemoryUsage {
+        qsizetype objectCount = 0;
+        qsizetype qmlDataBytes = 0;
+        qsizetype bindingBitsBytes = 0;
+        qsizetype notifyListBytes = 0;
+        qsizetype extendedDataBytes = 0;
+        qsizetype deferredDataBytes = 0;
+
+        qsizetype totalBytes() const
+        {
+            return qmlDataBytes + bindingBitsBytes + notifyListBytes + extendedDataBytes
+                    + deferredDataBytes;
+        }
+    };
+
+    void addMemoryUsage(MemoryUsage *usage) const;
+    static MemoryUsage memoryUsage(const QObject *root);
+
     Q_ALWAYS_INLINE static uint offsetForBit(int bit) { return static_cast<uint>(bit) / BitsPerType; }
     Q_ALWAYS_INLINE static BindingBitsType bitFlagForBit(int bit) { return BindingBitsType(1) << (static_cast<uint>(bit) & (BitsPerType - 1)); }
 
 private:
-    // For attachedProperties
+    // For attached properties, deferred data and property observers
     mutable QQmlDataExtended *extendedData;
 
+    QQmlDataExtended *extended() const;
+
     Q_NEVER_INLINE static QQmlData *createQQmlData(QObjectPrivate *priv);
     Q_NEVER_INLINE static QQmlPropertyCache::ConstPtr createPropertyCache(QObject *object);
 
@@ -298,6 +324,10 @@ private:
     Q_DISABLE_COPY(QQmlData);
 };
 
+#ifndef QT_NO_DEBUG_STREAM
+Q_QML_PRIVATE_EXPORT QDebug operator<<(QDebug debug, const QQmlData::MemoryUsage &usage);
+#endif
+
 bool QQmlData::wasDeleted(const QObjectPrivate *priv)
 {
     if (!priv || priv->wasDeleted || priv->isDeletingChildren)
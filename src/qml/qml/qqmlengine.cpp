@@ -1059,6 +1059,8 @@ public:
     ~QQmlDataExtended();
 
     QHash<QQmlAttachedPropertiesFunc, QObject *> attachedProperties;
+    QVector<QQmlData::DeferredData *> deferredData;
+    std::vector<QQmlPropertyObserver> propertyObservers;
 };
 
 QQmlDataExtended::QQmlDataExtended()
@@ -1141,11 +1143,15 @@ void QQmlData::deferData(
             deferData->bindings.insert(property ? property->coreIndex() : -1, binding);
     }
 
-    deferredData.append(deferData);
+    extended()->deferredData.append(deferData);
 }
 
 void QQmlData::releaseDeferredData()
 {
+    if (!extendedData)
+        return;
+
+    QVector<DeferredData *> &deferredData = extendedData->deferredData;
     auto it = deferredData.begin();
     while (it != deferredData.end()) {
         DeferredData *deferData = *it;
@@ -1206,12 +1212,103 @@ void QQmlData::disconnectNotifiers()
     }
 }
 
-QHash<QQmlAttachedPropertiesFunc, QObject *> *QQmlData::attachedProperties() const
+QQmlDataExtended *QQmlData::extended() const
 {
     if (!extendedData) extendedData = new QQmlDataExtended;
-    return &extendedData->attachedProperties;
+    return extendedData;
+}
+
+QHash<QQmlAttachedPropertiesFunc, QObject *> *QQmlData::attachedProperties() const
+{
+    return &extended()->attachedProperties;
+}
+
+bool QQmlData::hasDeferredData() const
+{
+    return extendedData && !extendedData->deferredData.isEmpty();
+}
+
+const QVector<QQmlData::DeferredData *> &QQmlData::deferredData() const
+{
+    static const QVector<DeferredData *> noDeferredData;
+    return extendedData ? extendedData->deferredData : noDeferredData;
+}
+
+std::vector<QQmlPropertyObserver> &QQmlData::propertyObservers()
+{
+    return extended()->propertyObservers;
+}
+
+/*!
+    \internal
+    Adds the heap memory used by this QQmlData and the parts of it allocated on demand
+    to \a usage.
+*/
+void QQmlData::addMemoryUsage(MemoryUsage *usage) const
+{
+    ++usage->objectCount;
+    // Without ownMemory the QQmlData is allocated together with the object, but it still
+    // adds to the object's footprint.
+    usage->qmlDataBytes += sizeof(QQmlData);
+    if (bindingBitsArraySize > InlineBindingArraySize)
+        usage->bindingBitsBytes += bindingBitsArraySize * sizeof(BindingBitsType);
+    if (notifyList) {
+        usage->notifyListBytes += sizeof(NotifyList)
+                + notifyList->notifiesSize * sizeof(QQmlNotifierEndpoint *);
+    }
+    if (extendedData) {
+        usage->extendedDataBytes += sizeof(QQmlDataExtended)
+                + extendedData->attachedProperties.capacity()
+                        * sizeof(std::pair<QQmlAttachedPropertiesFunc, QObject *>)
+                + extendedData->propertyObservers.capacity() * sizeof(QQmlPropertyObserver);
+        for (const DeferredData *deferData : std::as_const(extendedData->deferredData)) {
+            usage->deferredDataBytes += sizeof(DeferredData)
+                    + deferData->bindings.size()
+                            * sizeof(std::pair<int, const QV4::CompiledData::Binding *>);
+        }
+    }
+}
+
+/*!
+    \internal
+    Returns the QML bookkeeping overhead of \a root and all its QObject children.
+    Objects that never got a QQmlData are not counted.
+*/
+QQmlData::MemoryUsage QQmlData::memoryUsage(const QObject *root)
+{
+    MemoryUsage usage;
+    if (!root)
+        return usage;
+
+    QVarLengthArray<const QObject *, 64> pending;
+    pending.append(root);
+    while (!pending.isEmpty()) {
+        const QObject *object = pending.takeLast();
+        if (const QQmlData *ddata = QQmlData::get(object))
+            ddata->addMemoryUsage(&usage);
+        for (const QObject *child : object->children())
+            pending.append(child);
+    }
+    return usage;
 }
 
+#ifndef QT_NO_DEBUG_STREAM
+QDebug operator<<(QDebug debug, const QQmlData::MemoryUsage &usage)
+{
+    QDebugStateSaver saver(debug);
+    debug.nospace() << "QQmlData::MemoryUsage(objects=" << usage.objectCount
+                    << ", total=" << usage.totalBytes()
+                    << ", perObject="
+                    << (usage.objectCount ? usage.totalBytes() / usage.objectCount : 0)
+                    << ", qmlData=" << usage.qmlDataBytes
+                    << ", bindingBits=" << usage.bindingBitsBytes
+                    << ", notifyLists=" << usage.notifyListBytes
+                    << ", extendedData=" << usage.extendedDataBytes
+                    << ", deferredData=" << usage.deferredDataBytes << ')';
+    return debug;
+}
+#endif
+
 void QQmlData::destroyed(QObject *object)
 {
     if (nextContextObject)
@@ -1231,8 +1328,10 @@ void QQmlData::destroyed(QObject *object)
 
     compilationUnit.reset();
 
-    qDeleteAll(deferredData);
-    deferredData.clear();
+    if (extendedData) {
+        qDeleteAll(extendedData->deferredData);
+        extendedData->deferredData.clear();
+    }
 
     QQmlBoundSignal *signalHandler = signalHandlers;
     while (signalHandler) {
@@ -162,10 +162,14 @@ public:
     // Unfortunate workaround to avoid a circular dependency between
     // qqmlengine_p.h and qqmlincubator_p.h
     struct Incubator {
+        enum Priority : quint8 { LowPriority, NormalPriority, HighPriority };
         QIntrusiveListNode next;
+        Priority priority = NormalPriority;
     };
-    QIntrusiveList<Incubator, &Incubator::next> incubatorList;
+    // One list per priority. Incubation always continues with the highest priority one.
+    QIntrusiveList<Incubator, &Incubator::next> incubatorLists[Incubator::HighPriority + 1];
     unsigned int incubatorCount = 0;
+    Incubator *nextIncubator() const;
     QQmlIncubationController *incubationController = nullptr;
     void incubate(QQmlIncubator &, const QQmlRefPointer<QQmlContextData> &);
 
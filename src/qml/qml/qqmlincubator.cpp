@@ -36,6 +36,10 @@ void QQmlEnginePrivate::incubate(
             mode = QQmlIncubator::Asynchronous;
             p->waitingOnMe = parentIncubator;
             parentIncubator->waitingFor.insert(p.data());
+
+            // The parent can't complete before we do.
+            if (parentIncubator->priority > p->priority)
+                p->priority = parentIncubator->priority;
         }
     }
 
@@ -53,7 +57,7 @@ void QQmlEnginePrivate::incubate(
             p->incubate(i);
         }
     } else {
-        incubatorList.insert(p.data());
+        incubatorLists[p->priority].insert(p.data());
         incubatorCount++;
 
         p->vmeGuard.guard(p->creator.data());
@@ -64,6 +68,15 @@ void QQmlEnginePrivate::incubate(
     }
 }
 
+QQmlEnginePrivate::Incubator *QQmlEnginePrivate::nextIncubator() const
+{
+    for (int priority = Incubator::HighPriority; priority >= Incubator::LowPriority; --priority) {
+        if (Incubator *incubator = incubatorLists[priority].first())
+            return incubator;
+    }
+    return nullptr;
+}
+
 /*!
 Sets the engine's incubation \a controller.  The engine can only have one active controller
 and it does not take ownership of it.
@@ -139,6 +152,26 @@ void QQmlIncubatorPrivate::clear()
     creator.reset(nullptr);
 }
 
+/*!
+    \internal
+    Changes the priority of this incubator to \a newPriority. Asynchronous incubators are
+    processed from the highest priority down. An incubator that has already started is
+    preempted by higher priority ones once its current time slice is over. The incubators
+    this one waits for are moved along with it, as it can't complete before they do.
+*/
+void QQmlIncubatorPrivate::setPriority(Priority newPriority)
+{
+    if (priority == newPriority)
+        return;
+
+    priority = newPriority;
+    if (next.isInList())
+        enginePriv->incubatorLists[priority].insert(this);
+
+    for (auto it = waitingFor.begin(), end = waitingFor.end(); it != end; ++it)
+        (*it)->setPriority(newPriority);
+}
+
 /*!
 \class QQmlIncubationController
 \brief QQmlIncubationController instances drive the progress of QQmlIncubators.
@@ -369,7 +402,7 @@ void QQmlIncubationController::incubateFor(int msecs)
     QQmlInstantiationInterrupt i(msecs * Q_INT64_C(1000000));
     i.reset();
     do {
-        static_cast<QQmlIncubatorPrivate*>(d->incubatorList.first())->incubate(i);
+        static_cast<QQmlIncubatorPrivate*>(d->nextIncubator())->incubate(i);
     } while (d && d->incubatorCount != 0 && !i.shouldInterrupt());
 }
 
@@ -393,7 +426,7 @@ void QQmlIncubationController::incubateWhile(std::atomic<bool> *flag, int msecs)
     QQmlInstantiationInterrupt i(flag, msecs * Q_INT64_C(1000000));
     i.reset();
     do {
-        static_cast<QQmlIncubatorPrivate*>(d->incubatorList.first())->incubate(i);
+        static_cast<QQmlIncubatorPrivate*>(d->nextIncubator())->incubate(i);
     } while (d && d->incubatorCount != 0 && !i.shouldInterrupt());
 }
 
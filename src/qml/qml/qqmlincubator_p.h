@@ -67,6 +67,7 @@ public:
     QVariantMap initialProperties;
 
     void clear();
+    void setPriority(Priority newPriority);
 
     void forceCompletion(QQmlInstantiationInterrupt &i);
     void incubate(QQmlInstantiationInterrupt &i);
@@ -169,8 +169,11 @@ public:
         lastPropertyCapture = ep->propertyCapture;
         ep->propertyCapture = expression->notifyOnValueChanged() ? &capture : nullptr;
 
-        if (expression->notifyOnValueChanged())
+        if (expression->notifyOnValueChanged()) {
             capture.guards.copyAndClearPrepend(expression->activeGuards);
+            if (QV4::Function *function = expression->function())
+                capture.hasStaticDependencies = function->hasStaticDependencies();
+        }
     }
 
     ~QQmlJavaScriptExpressionCapture()
@@ -280,6 +283,14 @@ void QQmlPropertyCapture::captureProperty(QQmlNotifier *n)
         return;
 
     Q_ASSERT(expression);
+
+    if (QQmlJavaScriptExpressionGuard *g = takeStaticGuard()) {
+        if (!g->isConnected(n))
+            g->connect(n);
+        expression->activeGuards.prepend(g);
+        return;
+    }
+
     // Try and find a matching guard
     while (!guards.isEmpty() && !guards.first()->isConnected(n))
         guards.takeFirst()->Delete();
@@ -401,6 +412,10 @@ void QQmlPropertyCapture::captureNonBindableProperty(QObject *o, int n, int c, b
                 QLatin1String("::") +
                 QString::fromUtf8(metaProp.name());
         errorString->append(error);
+    } else if (QQmlJavaScriptExpressionGuard *g = takeStaticGuard()) {
+        if (!g->isConnected(o, n))
+            g->connect(o, n, engine, doNotify);
+        expression->activeGuards.prepend(g);
     } else {
 
         // Try and find a matching guard
@@ -421,6 +436,22 @@ void QQmlPropertyCapture::captureNonBindableProperty(QObject *o, int n, int c, b
     }
 }
 
+/*! \internal
+
+    For expressions with static dependencies the guard at the current position belonged to the
+    same dependency in the previous evaluation. It is kept connected if its source is unchanged,
+    or re-targeted otherwise, so that a changed source does not tear down the guards that follow.
+*/
+QQmlJavaScriptExpressionGuard *QQmlPropertyCapture::takeStaticGuard()
+{
+    if (!hasStaticDependencies || guards.isEmpty())
+        return nullptr;
+
+    QQmlJavaScriptExpressionGuard *g = guards.takeFirst();
+    g->cancelNotify();
+    return g;
+}
+
 QQmlError QQmlJavaScriptExpression::error(QQmlEngine *engine) const
 {
     Q_UNUSED(engine);
@@ -187,7 +187,7 @@ class Q_QML_PRIVATE_EXPORT QQmlPropertyCapture
 {
 public:
     QQmlPropertyCapture(QQmlEngine *engine, QQmlJavaScriptExpression *e, QQmlJavaScriptExpression::DeleteWatcher *w)
-    : engine(engine), expression(e), watcher(w), errorString(nullptr) { }
+    : engine(engine), expression(e), watcher(w), errorString(nullptr), hasStaticDependencies(false) { }
 
     ~QQmlPropertyCapture()  {
         Q_ASSERT(guards.isEmpty());
@@ -205,7 +205,12 @@ public:
     QForwardFieldList<QQmlJavaScriptExpressionGuard, &QQmlJavaScriptExpressionGuard::next> guards;
     QStringList *errorString;
 
+    // The compiler proved that the expression captures the same sequence of dependencies on
+    // every evaluation. Only their sources may change.
+    bool hasStaticDependencies;
+
 private:
+    QQmlJavaScriptExpressionGuard *takeStaticGuard();
     void captureBindableProperty(QObject *o, const QMetaObject *metaObjectForBindable, int c);
     void captureNonBindableProperty(QObject *o, int n, int c, bool doNotify);
 };
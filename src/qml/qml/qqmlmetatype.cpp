@@ -1472,6 +1472,16 @@ void QQmlMetaType::freeUnusedTypesAndCaches()
                 ++it;
             }
         }
+
+        auto sharedIt = data->sharedCompositePropertyCaches.begin();
+        while (sharedIt != data->sharedCompositePropertyCaches.end()) {
+            if ((*sharedIt)->count() == 1) {
+                sharedIt = data->sharedCompositePropertyCaches.erase(sharedIt);
+                deletedAtLeastOneCache = true;
+            } else {
+                ++sharedIt;
+            }
+        }
     } while (deletedAtLeastOneCache);
 }
 
@@ -1766,6 +1776,77 @@ void QQmlMetaType::unregisterInternalCompositeType(QV4::ExecutableCompilationUni
         data->compositeTypes.remove(icDatum.typeIds.id.iface());
 }
 
+static QByteArray compositeClassNameBase(const QByteArray &className)
+{
+    for (const char *marker : { "_QMLTYPE_", "_QML_" }) {
+        const qsizetype index = className.indexOf(marker);
+        if (index != -1)
+            return className.left(index);
+    }
+    return className;
+}
+
+/*!
+    \internal
+    Replaces the property caches \a compilationUnit has created for its objects by identical ones
+    another engine has already created for the same compiled objects. Caches that are not known
+    yet are offered for sharing.
+
+    Property caches are immutable once the type is compiled. Two caches are identical if they
+    were created from the same compiled object, on top of the same parent cache, and all of
+    their members resolved to the same types. Members typed as composite types never match
+    across engines, as composite types are registered per engine.
+
+    This has to happen before anything retains pointers into the caches. Inline component roots
+    are skipped since their caches are also referenced from the resolved type references.
+*/
+void QQmlMetaType::shareCompositePropertyCaches(QV4::ExecutableCompilationUnit *compilationUnit)
+{
+    const QV4::CompiledData::Unit *unit = compilationUnit->unitData();
+    if (!unit)
+        return;
+
+    // Without a checksum we cannot tell compilation units apart.
+    static const char noChecksum[sizeof(QV4::CompiledData::Unit::md5Checksum)] = {};
+    if (memcmp(unit->md5Checksum, noChecksum, sizeof(noChecksum)) == 0)
+        return;
+
+    QQmlPropertyCacheVector &caches = compilationUnit->propertyCaches;
+    QQmlMetaTypeDataPtr data;
+    for (int i = 0, end = caches.count(); i != end; ++i) {
+        if (!caches.needsVMEMetaObject(i))
+            continue;
+
+        const QV4::CompiledData::Object *object = compilationUnit->objectAt(i);
+        if (object->hasFlag(QV4::CompiledData::Object::IsInlineComponentRoot))
+            continue;
+
+        const QQmlPropertyCache::ConstPtr cache = caches.at(i);
+        if (!cache)
+            continue;
+
+        const QQmlPropertyCache *parent = cache->parent().data();
+        QByteArray key;
+        key.append(unit->md5Checksum, sizeof(unit->md5Checksum));
+        key.append(unit->dependencyMD5Checksum, sizeof(unit->dependencyMD5Checksum));
+        key.append(reinterpret_cast<const char *>(&i), sizeof(i));
+        key.append(reinterpret_cast<const char *>(&parent), sizeof(parent));
+        cache->appendOwnTypeIdentities(&key);
+
+        // The root object's class name is derived from the URL, so that identical documents
+        // with different names don't share it. All class names end with a process-wide
+        // counter, though, which differs between engines and is left out.
+        if (i == 0)
+            key.append(compositeClassNameBase(cache->className()));
+
+        const auto it = data->sharedCompositePropertyCaches.constFind(key);
+        if (it == data->sharedCompositePropertyCaches.constEnd())
+            data->sharedCompositePropertyCaches.insert(key, cache);
+        else if (*it != cache)
+            caches.set(i, *it);
+    }
+}
+
 QV4::ExecutableCompilationUnit *QQmlMetaType::obtainExecutableCompilationUnit(QMetaType type)
 {
     const QQmlMetaTypeDataPtr data;
@@ -264,6 +264,7 @@ public:
     static QQmlPropertyCache::ConstPtr findPropertyCacheInCompositeTypes(QMetaType t);
     static void registerInternalCompositeType(QV4::ExecutableCompilationUnit *compilationUnit);
     static void unregisterInternalCompositeType(QV4::ExecutableCompilationUnit *compilationUnit);
+    static void shareCompositePropertyCaches(QV4::ExecutableCompilationUnit *compilationUnit);
     static QV4::ExecutableCompilationUnit *obtainExecutableCompilationUnit(QMetaType type);
 };
 
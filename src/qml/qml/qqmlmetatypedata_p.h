@@ -96,6 +96,10 @@ struct QQmlMetaTypeData
 
     QHash<const QMetaObject *, QQmlPropertyCache::ConstPtr> propertyCaches;
 
+    // Property caches of composite types, shared between all engines that load the same
+    // compiled object and resolve it to the same types. See shareCompositePropertyCaches().
+    QHash<QByteArray, QQmlPropertyCache::ConstPtr> sharedCompositePropertyCaches;
+
     QQmlPropertyCache::ConstPtr propertyCacheForVersion(int index, QTypeRevision version) const;
     void setPropertyCacheForVersion(
             int index, QTypeRevision version, const QQmlPropertyCache::ConstPtr &cache);
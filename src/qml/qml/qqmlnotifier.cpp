@@ -104,8 +104,8 @@ void QQmlNotifierEndpoint::connect(QObject *source, int sourceSignal, QQmlEngine
     QQmlPropertyPrivate::flushSignal(source, sourceSignal);
     QQmlData *ddata = QQmlData::get(source, true);
     ddata->addNotify(sourceSignal, this);
+    needsConnectNotify = doNotify;
     if (doNotify) {
-        needsConnectNotify = doNotify;
         QObjectPrivate * const priv = QObjectPrivate::get(source);
         priv->connectNotify(QMetaObjectPrivate::signal(source->metaObject(), sourceSignal));
     }
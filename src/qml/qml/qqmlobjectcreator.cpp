@@ -817,6 +817,10 @@ bool QQmlObjectCreator::setPropertyBinding(const QQmlPropertyData *bindingProper
         const QV4::CompiledData::Object *obj = compilationUnit->objectAt(binding->value.objectIndex);
         if (stringAt(obj->inheritedTypeNameIndex).isEmpty()) {
 
+            // There is nothing to assign for an empty group. We still check that the
+            // group exists, but don't round-trip value types or populate the group.
+            const bool isEmptyGroup = obj->nBindings == 0 && obj->nFunctions == 0;
+
             QObject *groupObject = nullptr;
             QQmlGadgetPtrWrapper *valueType = nullptr;
             const QQmlPropertyData *valueTypeProperty = nullptr;
@@ -839,6 +843,8 @@ bool QQmlObjectCreator::setPropertyBinding(const QQmlPropertyData *bindingProper
                     recordError(binding->location, tr("Cannot set properties on %1 as it is null").arg(stringAt(binding->propertyNameIndex)));
                     return false;
                 }
+                if (isEmptyGroup)
+                    return true;
 
                 valueType->read(_qobject, bindingProperty->coreIndex());
 
@@ -855,6 +861,9 @@ bool QQmlObjectCreator::setPropertyBinding(const QQmlPropertyData *bindingProper
                 bindingTarget = groupObject;
             }
 
+            if (isEmptyGroup)
+                return true;
+
             if (!populateInstance(groupObjectIndex, groupObject, bindingTarget, valueTypeProperty,
                                   binding)) {
                 return false;
@@ -910,7 +919,7 @@ bool QQmlObjectCreator::setPropertyBinding(const QQmlPropertyData *bindingProper
                     Q_ASSERT(data && data->propertyCache);
                     bindingProperty = data->propertyCache->property(aliasTargetIndex.coreIndex());
                 }
-                auto &observer = QQmlData::get(_scopeObject)->propertyObservers.emplace_back(expr);
+                auto &observer = QQmlData::get(_scopeObject)->propertyObservers().emplace_back(expr);
                 QUntypedBindable bindable;
                 void *argv[] = { &bindable };
                 target->qt_metacall(QMetaObject::BindableProperty, bindingProperty->coreIndex(), argv);
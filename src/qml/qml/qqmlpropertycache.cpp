@@ -1229,6 +1229,33 @@ bool QQmlPropertyCache::addToHash(QCryptographicHash &hash, const QMetaObject &m
     return true;
 }
 
+/*! \internal
+    Appends the identities of all types used by the properties, methods and signals this cache
+    adds on top of its parent to \a key. Composite types are registered per engine. Therefore,
+    caches created from the same compiled object in different engines only have the same type
+    identities if none of their members refers to a composite type.
+ */
+void QQmlPropertyCache::appendOwnTypeIdentities(QByteArray *key) const
+{
+    const auto appendType = [key](QMetaType type) {
+        const QtPrivate::QMetaTypeInterface *iface = type.iface();
+        key->append(reinterpret_cast<const char *>(&iface), sizeof(iface));
+    };
+
+    for (const QQmlPropertyData &data : propertyIndexCache)
+        appendType(data.propType());
+
+    for (const QQmlPropertyData &data : methodIndexCache) {
+        appendType(data.propType());
+        if (const QQmlPropertyCacheMethodArguments *arguments = data.arguments()) {
+            // The first entry is the return type, followed by one per named parameter.
+            const qsizetype count = arguments->names ? arguments->names->size() : 0;
+            for (qsizetype i = 0; i <= count; ++i)
+                appendType(arguments->types[i]);
+        }
+    }
+}
+
 QByteArray QQmlPropertyCache::checksum(QHash<quintptr, QByteArray> *checksums, bool *ok) const
 {
     auto it = checksums->constFind(quintptr(this));
@@ -223,6 +223,7 @@ public:
     static bool addToHash(QCryptographicHash &hash, const QMetaObject &mo);
 
     QByteArray checksum(QHash<quintptr, QByteArray> *checksums, bool *ok) const;
+    void appendOwnTypeIdentities(QByteArray *key) const;
 
     QTypeRevision allowedRevision(int index) const { return allowedRevisionCache[index]; }
     void setAllowedRevision(int index, QTypeRevision allowed) { allowedRevisionCache[index] = allowed; }
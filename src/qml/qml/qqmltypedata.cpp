@@ -3,6 +3,7 @@
 
 #include <private/qqmltypedata_p.h>
 #include <private/qqmlengine_p.h>
+#include <private/qqmlglobal_p.h>
 #include <private/qqmlpropertycachecreator_p.h>
 #include <private/qqmlpropertyvalidator_p.h>
 #include <private/qqmlirbuilder_p.h>
@@ -22,6 +23,8 @@ Q_LOGGING_CATEGORY(lcCycle, "qt.qml.typeresolution.cycle")
 
 QT_BEGIN_NAMESPACE
 
+DEFINE_BOOL_CONFIG_OPTION(disableSharedPropertyCaches, QML_DISABLE_SHARED_PROPERTY_CACHES);
+
 QQmlTypeData::TypeDataCallback::~TypeDataCallback()
 {
 }
@@ -422,6 +425,18 @@ void QQmlTypeData::done()
     {
         QQmlEnginePrivate *const enginePrivate = QQmlEnginePrivate::get(typeLoader()->engine());
         m_compiledData->inlineComponentData = m_inlineComponentData;
+
+        // Must happen before the validator records pointers into the property caches.
+        if (!disableSharedPropertyCaches()) {
+            // A shared root cache carries the class name of the engine that created it. Register
+            // the meta type under our own class name first so that names stay unique.
+            if (!m_typeIds.isValid() && m_compiledData->propertyCaches.needsVMEMetaObject(0)) {
+                m_typeIds = CompositeMetaTypeIds::fromCompositeName(
+                        m_compiledData->rootPropertyCache()->className());
+            }
+            QQmlMetaType::shareCompositePropertyCaches(m_compiledData.data());
+        }
+
         {
             // Sanity check property bindings
             QQmlPropertyValidator validator(enginePrivate, m_importCache.data(), m_compiledData);
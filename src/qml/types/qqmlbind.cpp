@@ -872,9 +872,9 @@ void QQmlBindPrivate::evalDelayed()
 void QQmlBindPrivate::buildBindEntries(QQmlBind *q, QQmlComponentPrivate::DeferredState *deferredState)
 {
     QQmlData *data = QQmlData::get(q);
-    if (data && !data->deferredData.isEmpty()) {
+    if (data && data->hasDeferredData()) {
         QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine());
-        for (QQmlData::DeferredData *deferredData : data->deferredData) {
+        for (QQmlData::DeferredData *deferredData : data->deferredData()) {
             QMultiHash<int, const QV4::CompiledData::Binding *> *bindings = &deferredData->bindings;
             if (deferredState) {
                 QQmlComponentPrivate::ConstructionState constructionState;
@@ -13,6 +13,7 @@
 #include <private/qqmlchangeset_p.h>
 #include <private/qqmlengine_p.h>
 #include <private/qqmlcomponent_p.h>
+#include <private/qqmlincubator_p.h>
 #include <private/qqmlpropertytopropertybinding_p.h>
 #include <private/qjsvalue_p.h>
 
@@ -20,6 +21,12 @@
 #include <private/qv4functionobject_p.h>
 #include <private/qv4objectiterator_p.h>
 
+#include <QtCore/qset.h>
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 QT_BEGIN_NAMESPACE
 
 Q_LOGGING_CATEGORY(lcItemViewDelegateRecycling, "qt.qml.delegatemodel.recycling")
@@ -265,6 +272,27 @@ void QQmlDelegateModel::classBegin()
         d->m_context = qmlContext(this);
 }
 
+template <typename Changes>
+static QList<int> itemsGroupIndexes(const Changes &changes)
+{
+    QList<int> indexes;
+    for (const auto &change : changes) {
+        if (!change.inGroup(Compositor::Default))
+            continue;
+        for (int i = 0; i < change.count; ++i)
+            indexes.append(change.index[Compositor::Default] + i);
+    }
+    std::sort(indexes.begin(), indexes.end());
+    return indexes;
+}
+
+static QList<int> allIndexes(int count)
+{
+    QList<int> indexes(count);
+    std::iota(indexes.begin(), indexes.end(), 0);
+    return indexes;
+}
+
 void QQmlDelegateModel::componentComplete()
 {
     Q_D(QQmlDelegateModel);
@@ -318,6 +346,8 @@ void QQmlDelegateModel::componentComplete()
             defaultGroups | Compositor::AppendFlag | Compositor::PrependFlag,
             &inserts);
     d->itemsInserted(inserts);
+    if (d->isSortedOrFiltered())
+        d->updateSortAndFilter(allIndexes(d->m_compositor.count(Compositor::Default)));
     d->emitChanges();
     d->requestMoreIfNecessary();
 }
@@ -407,7 +437,13 @@ void QQmlDelegateModel::setModel(const QVariant &model)
 {
     Q_D(QQmlDelegateModel);
 
-    if (d->m_complete)
+    // With a key role, replacing a list of values with another one is applied
+    // as a diff, so that the delegates of entries that are kept can be reused.
+    QList<QString> oldKeys;
+    const bool keyed = d->m_complete && d->listKeys(&oldKeys) && oldKeys.size() == d->m_count;
+    const QQmlListAccessor oldList = keyed ? d->m_adaptorModel.list : QQmlListAccessor();
+
+    if (d->m_complete && !keyed)
         _q_itemsRemoved(0, d->m_count);
 
     d->disconnectFromAbstractItemModel();
@@ -421,11 +457,461 @@ void QQmlDelegateModel::setModel(const QVariant &model)
     }
 
     if (d->m_complete) {
-        _q_itemsInserted(0, d->adaptorModelCount());
+        QList<QString> newKeys;
+        if (keyed && d->listKeys(&newKeys)) {
+            d->applyListDiff(oldList, oldKeys, newKeys);
+        } else {
+            if (keyed)
+                _q_itemsRemoved(0, d->m_count);
+            _q_itemsInserted(0, d->adaptorModelCount());
+        }
         d->requestMoreIfNecessary();
     }
 }
 
+/*
+    Returns which elements of \a sequence are part of one of its longest
+    strictly increasing subsequences.
+*/
+static QList<bool> longestIncreasingSubsequence(const QList<int> &sequence)
+{
+    const int count = sequence.size();
+    QList<int> tails;               // index of the smallest tail of each length
+    QList<int> predecessors(count, -1);
+    for (int i = 0; i < count; ++i) {
+        const auto it = std::lower_bound(tails.begin(), tails.end(), sequence.at(i), [&](int t, int v) {
+            return sequence.at(t) < v;
+        });
+        const int length = int(it - tails.begin());
+        if (length > 0)
+            predecessors[i] = tails.at(length - 1);
+        if (it == tails.end())
+            tails.append(i);
+        else
+            *it = i;
+    }
+
+    QList<bool> members(count, false);
+    for (int i = tails.isEmpty() ? -1 : tails.last(); i != -1; i = predecessors.at(i))
+        members[i] = true;
+    return members;
+}
+
+/*
+    Calls \a move with the single item moves that reorder a list so that the
+    item at position order[i] ends up at position i. Items on a longest
+    increasing subsequence of \a order keep their place, all others are moved
+    once, right behind the item preceding them in the new order.
+
+    The positions are counted with a Fenwick tree rather than searched for in
+    the list, so that reordering n items takes O(n log n) apart from the moves.
+*/
+template <typename Move>
+static void applyOrder(const QList<int> &order, Move move)
+{
+    const int count = order.size();
+    const QList<bool> stable = longestIncreasingSubsequence(order);
+
+    // Slot 0 counts the items moved to the front, slot p + 1 the item that was at
+    // position p and the items moved right behind it. Moved items only ever go
+    // behind a kept item, or behind the items already moved there.
+    QList<int> tree(count + 2, 0);
+    const auto add = [&](int slot, int delta) {
+        for (int i = slot + 1; i < tree.size(); i += i & -i)
+            tree[i] += delta;
+    };
+    const auto countBefore = [&](int slot) {
+        int sum = 0;
+        for (int i = slot; i > 0; i -= i & -i)
+            sum += tree.at(i);
+        return sum;
+    };
+    for (int slot = 1; slot <= count; ++slot)
+        add(slot, 1);
+
+    int keptSlot = 0;
+    for (int i = 0; i < count; ++i) {
+        const int slot = order.at(i) + 1;
+        if (stable.at(i)) {
+            keptSlot = slot;
+            continue;
+        }
+        const int from = countBefore(slot);
+        add(slot, -1);
+        const int to = countBefore(keptSlot + 1);
+        add(keptSlot, 1);
+        if (from != to)
+            move(from, to);
+    }
+}
+
+/*!
+    \internal
+    Collects the value of the key role for every entry of the model into \a keys.
+    Returns \c false if no key role is set, the model is not a list of values,
+    or the keys are not unique strings or numbers.
+*/
+bool QQmlDelegateModelPrivate::listKeys(QList<QString> *keys) const
+{
+    if (m_keyRole.isEmpty())
+        return false;
+
+    switch (m_adaptorModel.list.type()) {
+    case QQmlListAccessor::StringList:
+    case QQmlListAccessor::UrlList:
+    case QQmlListAccessor::VariantList:
+    case QQmlListAccessor::Sequence:
+        break;
+    default:
+        return false;
+    }
+
+    const int count = m_adaptorModel.count();
+    QSet<QString> seen;
+    seen.reserve(count);
+    keys->reserve(count);
+    for (int i = 0; i < count; ++i) {
+        const QVariant value = m_adaptorModel.value(i, m_keyRole);
+        if (!value.isValid() || !value.canConvert<QString>())
+            return false;
+        const QString key = value.toString();
+        if (seen.contains(key))
+            return false;
+        seen.insert(key);
+        keys->append(key);
+    }
+    return true;
+}
+
+/*!
+    \internal
+    Turns the replacement of \a oldList, whose entries have the keys \a oldKeys,
+    with the current list model, whose entries have the keys \a newKeys, into
+    removals, moves, insertions and changes of individual entries. The entries
+    that are neither removed nor inserted keep their delegates. The edits are
+    collected into one change set per group, which is emitted once at the end.
+*/
+void QQmlDelegateModelPrivate::applyListDiff(
+        const QQmlListAccessor &oldList, const QList<QString> &oldKeys,
+        const QList<QString> &newKeys)
+{
+    Q_Q(QQmlDelegateModel);
+
+    QHash<QString, int> oldIndexes;
+    oldIndexes.reserve(oldKeys.size());
+    for (int i = 0; i < oldKeys.size(); ++i)
+        oldIndexes.insert(oldKeys.at(i), i);
+    QHash<QString, int> newIndexes;
+    newIndexes.reserve(newKeys.size());
+    for (int i = 0; i < newKeys.size(); ++i)
+        newIndexes.insert(newKeys.at(i), i);
+
+    m_transaction = true;
+
+    // Remove the entries that are gone, from the back so that indexes stay valid.
+    QList<QString> current = oldKeys;
+    for (int i = current.size() - 1; i >= 0;) {
+        if (newIndexes.contains(current.at(i))) {
+            --i;
+            continue;
+        }
+        int start = i;
+        while (start > 0 && !newIndexes.contains(current.at(start - 1)))
+            --start;
+        q->_q_itemsRemoved(start, i - start + 1);
+        current.remove(start, i - start + 1);
+        i = start - 1;
+    }
+
+    // The kept entries in their new order.
+    QList<QString> target;
+    target.reserve(current.size());
+    for (const QString &key : newKeys) {
+        if (oldIndexes.contains(key))
+            target.append(key);
+    }
+
+    // Entries on a longest increasing subsequence of old positions keep their
+    // place, all others are moved once, right behind their new predecessor.
+    QHash<QString, int> currentIndexes;
+    currentIndexes.reserve(current.size());
+    for (int i = 0; i < current.size(); ++i)
+        currentIndexes.insert(current.at(i), i);
+
+    const int targetCount = target.size();
+    QList<int> positions;
+    positions.reserve(targetCount);
+    for (const QString &key : std::as_const(target))
+        positions.append(currentIndexes.value(key));
+    applyOrder(positions, [&](int from, int to) {
+        q->_q_itemsMoved(from, to, 1);
+    });
+
+    // Insert the new entries, in ascending order so that indexes stay valid.
+    for (int i = 0; i < newKeys.size();) {
+        if (oldIndexes.contains(newKeys.at(i))) {
+            ++i;
+            continue;
+        }
+        int end = i + 1;
+        while (end < newKeys.size() && !oldIndexes.contains(newKeys.at(end)))
+            ++end;
+        q->_q_itemsInserted(i, end - i);
+        i = end;
+    }
+
+    // Report the kept entries whose value changed.
+    for (int i = 0; i < newKeys.size();) {
+        const auto changed = [&](int index) {
+            const auto it = oldIndexes.constFind(newKeys.at(index));
+            return it != oldIndexes.cend() && oldList.at(*it) != m_adaptorModel.list.at(index);
+        };
+        if (!changed(i)) {
+            ++i;
+            continue;
+        }
+        int end = i + 1;
+        while (end < newKeys.size() && changed(end))
+            ++end;
+        q->_q_itemsChanged(i, end - i, QVector<int>());
+        i = end;
+    }
+
+    m_transaction = false;
+    emitChanges();
+}
+
+bool QQmlDelegateModelPrivate::isSortedOrFiltered() const
+{
+    for (int i = 1; i < m_groupCount; ++i) {
+        const QQmlDelegateModelGroupPrivate *group = QQmlDelegateModelGroupPrivate::get(m_groups[i]);
+        if (group->isFiltered() || group->isSorted())
+            return true;
+    }
+    return false;
+}
+
+/*!
+    \internal
+    Updates the membership of filtered groups and the order of sorted groups
+    for the items at \a indexes in the items group, which were inserted or
+    changed. Other items are not evaluated again.
+*/
+void QQmlDelegateModelPrivate::updateSortAndFilter(const QList<int> &indexes)
+{
+    if (indexes.isEmpty() || !m_context || !m_context->isValid())
+        return;
+
+    QVarLengthArray<QQmlDelegateModelGroupPrivate *, Compositor::MaximumGroupCount> filteredGroups;
+    for (int i = Compositor::MinimumGroupCount; i < m_groupCount; ++i) {
+        QQmlDelegateModelGroupPrivate *group = QQmlDelegateModelGroupPrivate::get(m_groups[i]);
+        if (group->isFiltered())
+            filteredGroups.append(group);
+    }
+
+    if (!filteredGroups.isEmpty()) {
+        for (int index : indexes) {
+            // Evaluate all filters with the same object.
+            const QJSValue item = filterItem(index);
+            for (QQmlDelegateModelGroupPrivate *group : std::as_const(filteredGroups)) {
+                const bool accepted = filterAccepts(group, item);
+                Compositor::iterator it = m_compositor.find(Compositor::Default, index);
+                if (accepted == it->inGroup(group->group))
+                    continue;
+
+                if (accepted) {
+                    QVector<Compositor::Insert> inserts;
+                    m_compositor.setFlags(it, 1, Compositor::Default, 1 << group->group, &inserts);
+                    itemsInserted(inserts);
+                } else {
+                    QVector<Compositor::Remove> removes;
+                    m_compositor.clearFlags(it, 1, Compositor::Default, 1 << group->group, &removes);
+                    itemsRemoved(removes);
+                }
+            }
+        }
+    }
+
+    // Collect the positions of the items in all sorted groups before moving any of them.
+    QVarLengthArray<QList<int>, Compositor::MaximumGroupCount> positions(m_groupCount);
+    for (int i = Compositor::Default; i < m_groupCount; ++i) {
+        if (!QQmlDelegateModelGroupPrivate::get(m_groups[i])->isSorted())
+            continue;
+        for (int index : indexes) {
+            const Compositor::iterator it = m_compositor.find(Compositor::Default, index);
+            if (it->inGroup(i))
+                positions[i].append(it.index[i]);
+        }
+    }
+
+    // Moving items in one group reorders the others, so after the first sorted
+    // group has changed, the following ones are checked as a whole.
+    bool moved = false;
+    for (int i = Compositor::Default; i < m_groupCount; ++i) {
+        QQmlDelegateModelGroupPrivate *group = QQmlDelegateModelGroupPrivate::get(m_groups[i]);
+        if (group->isSorted())
+            moved |= sortGroup(group, moved ? nullptr : &positions[i]);
+    }
+}
+
+/*!
+    \internal
+    Returns the object the filters are called with for the item at \a index in
+    the items group. It is the object get() returns, but for items that are not
+    in the cache it wraps a temporary item, which is not added to the cache.
+    Filtering a large model thus doesn't create a cache item for every row.
+*/
+QJSValue QQmlDelegateModelPrivate::filterItem(int index)
+{
+    const Compositor::iterator it = m_compositor.find(Compositor::Default, index);
+    QQmlDelegateModelItem *cacheItem = it->inCache() ? m_cache.at(it.cacheIndex()) : nullptr;
+    if (!cacheItem) {
+        cacheItem = m_adaptorModel.createItem(m_cacheMetaType, it.modelIndex());
+        if (!cacheItem)
+            return QJSValue();
+        cacheItem->groups = it->flags;
+    }
+    return itemObject(cacheItem);
+}
+
+bool QQmlDelegateModelPrivate::filterAccepts(QQmlDelegateModelGroupPrivate *group, const QJSValue &item)
+{
+    const QJSValue result = group->filter.call(QJSValueList { item });
+    if (result.isError()) {
+        qmlWarning(m_groups[group->group]) << result.toString();
+        return false;
+    }
+    return result.toBool();
+}
+
+/*!
+    \internal
+    Restores the order of a sorted \a group, in which only the items at
+    \a positions may be out of order. If \a positions is null, any item may be
+    out of order. Returns \c true if items were moved.
+*/
+bool QQmlDelegateModelPrivate::sortGroup(
+        QQmlDelegateModelGroupPrivate *group, const QList<int> *positions)
+{
+    const Compositor::Group g = group->group;
+    const int count = m_compositor.count(g);
+    const auto valueAt = [&](int position) {
+        return m_adaptorModel.value(m_compositor.find(g, position).modelIndex(), group->sortRole);
+    };
+    const auto lessThan = [&](const QVariant &left, const QVariant &right) {
+        const QPartialOrdering order = group->sortOrder == Qt::AscendingOrder
+                ? QVariant::compare(left, right)
+                : QVariant::compare(right, left);
+        return order == QPartialOrdering::Less;
+    };
+
+    if (positions) {
+        bool sorted = true;
+        for (int position : *positions) {
+            const QVariant value = valueAt(position);
+            if ((position > 0 && lessThan(value, valueAt(position - 1)))
+                    || (position < count - 1 && lessThan(valueAt(position + 1), value))) {
+                sorted = false;
+                break;
+            }
+        }
+        if (sorted)
+            return false;
+
+        if (positions->size() == 1) {
+            // The other items are in order, so a binary search finds the new position.
+            const int from = positions->first();
+            const QVariant value = valueAt(from);
+            int low = 0;
+            int high = count - 1;
+            while (low < high) {
+                const int middle = (low + high) / 2;
+                if (lessThan(value, valueAt(middle < from ? middle : middle + 1)))
+                    high = middle;
+                else
+                    low = middle + 1;
+            }
+            moveInGroup(g, from, low);
+            return true;
+        }
+    }
+
+    if (count < 2)
+        return false;
+
+    QList<QVariant> values;
+    values.reserve(count);
+    Compositor::iterator it = m_compositor.find(g, 0);
+    for (int i = 0; i < count; ++i) {
+        if (i > 0)
+            it += 1;
+        values.append(m_adaptorModel.value(it.modelIndex(), group->sortRole));
+    }
+
+    QList<int> order = allIndexes(count);
+    std::stable_sort(order.begin(), order.end(), [&](int left, int right) {
+        return lessThan(values.at(left), values.at(right));
+    });
+
+    return moveToOrder(g, order);
+}
+
+/*!
+    \internal
+    Moves the items of \a group so that the item at position order[i] ends up
+    at position i. Returns \c true if items were moved.
+*/
+bool QQmlDelegateModelPrivate::moveToOrder(Compositor::Group group, const QList<int> &order)
+{
+    bool moved = false;
+    applyOrder(order, [&](int from, int to) {
+        moveInGroup(group, from, to);
+        moved = true;
+    });
+    return moved;
+}
+
+/*!
+    \internal
+    Puts the items back into the order of the model after a group stopped being
+    sorted, and sorts the groups that are still sorted again.
+*/
+void QQmlDelegateModelPrivate::restoreModelOrder()
+{
+    const int count = m_compositor.count(Compositor::Default);
+    QList<int> modelIndexes;
+    modelIndexes.reserve(count);
+    Compositor::iterator it = m_compositor.find(Compositor::Default, 0);
+    for (int i = 0; i < count; ++i) {
+        if (i > 0)
+            it += 1;
+        modelIndexes.append(it.modelIndex());
+    }
+
+    QList<int> order = allIndexes(count);
+    std::sort(order.begin(), order.end(), [&](int left, int right) {
+        return modelIndexes.at(left) < modelIndexes.at(right);
+    });
+    moveToOrder(Compositor::Default, order);
+
+    for (int i = Compositor::Default; i < m_groupCount; ++i) {
+        QQmlDelegateModelGroupPrivate *group = QQmlDelegateModelGroupPrivate::get(m_groups[i]);
+        if (group->isSorted())
+            sortGroup(group, nullptr);
+    }
+}
+
+void QQmlDelegateModelPrivate::moveInGroup(Compositor::Group group, int from, int to)
+{
+    if (from == to)
+        return;
+
+    QVector<Compositor::Remove> removes;
+    QVector<Compositor::Insert> inserts;
+    m_compositor.move(group, from, group, to, 1, group, &removes, &inserts);
+    itemsMoved(removes, inserts);
+}
+
 /*!
     \qmlproperty Component QtQml.Models::DelegateModel::delegate
 
@@ -535,6 +1021,39 @@ void QQmlDelegateModel::setRootIndex(const QVariant &root)
     }
 }
 
+/*!
+    \qmlproperty string QtQml.Models::DelegateModel::keyRole
+    \since 6.5
+
+    The role that uniquely identifies each entry of a \l {dm-model-property}{model}
+    that is a JavaScript array or a list of values, or \c modelData to use the
+    entries themselves.
+
+    By default, assigning a new array to the model replaces all entries and
+    destroys all delegates. If \c keyRole is set, the new array is instead
+    compared with the previous one by the keys of its entries. Entries with
+    keys that only appear in one of them are removed or inserted, entries that
+    changed position are moved, and entries with changed values are updated
+    in place, so that views keep the delegates of the entries that remain.
+
+    The keys have to be unique strings or numbers. If they are not, the model
+    is replaced as if \c keyRole was not set.
+*/
+QString QQmlDelegateModel::keyRole() const
+{
+    Q_D(const QQmlDelegateModel);
+    return d->m_keyRole;
+}
+
+void QQmlDelegateModel::setKeyRole(const QString &role)
+{
+    Q_D(QQmlDelegateModel);
+    if (d->m_keyRole == role)
+        return;
+    d->m_keyRole = role;
+    emit keyRoleChanged();
+}
+
 /*!
     \qmlmethod QModelIndex QtQml.Models::DelegateModel::modelIndex(int index)
 
@@ -597,9 +1116,10 @@ QQmlDelegateModel::ReleaseFlags QQmlDelegateModelPrivate::release(QObject *objec
 
     if (reusableFlag == QQmlInstanceModel::Reusable) {
         removeCacheItem(cacheItem);
-        m_reusableItemsPool.insertItem(cacheItem);
-        emit q_func()->itemPooled(cacheItem->index, cacheItem->object);
-        return QQmlInstanceModel::Pooled;
+        if (m_reusableItemsPool.insertItem(cacheItem)) {
+            emit q_func()->itemPooled(cacheItem->index, cacheItem->object);
+            return QQmlInstanceModel::Pooled;
+        }
     }
 
     destroyCacheItem(cacheItem);
@@ -1066,6 +1586,17 @@ int QQmlDelegateModel::poolSize()
     return d_func()->m_reusableItemsPool.size();
 }
 
+/*!
+    \internal
+    Sets the \a priority used for the items that are incubated asynchronously
+    from now on. Views lower it while they create items for their cache buffer,
+    so that those items don't hold up visible items incubating elsewhere.
+*/
+void QQmlDelegateModel::setIncubationPriority(QQmlIncubatorPrivate::Priority priority)
+{
+    d_func()->m_incubationPriority = priority;
+}
+
 QQmlComponent *QQmlDelegateModelPrivate::resolveDelegate(int index)
 {
     if (!m_delegateChooser)
@@ -1238,6 +1769,11 @@ QObject *QQmlDelegateModelPrivate::object(Compositor::Group group, int index, QQ
         cacheItem->incubationTask->incubating = cacheItem;
         cacheItem->incubationTask->clear();
 
+        if (m_incubationPriority != QQmlIncubatorPrivate::NormalPriority) {
+            QQmlIncubatorPrivate::get(cacheItem->incubationTask)->setPriority(
+                        m_incubationPriority);
+        }
+
         for (int i = 1; i < m_groupCount; ++i)
             cacheItem->incubationTask->index[i] = it.index[i];
 
@@ -1448,6 +1984,8 @@ void QQmlDelegateModel::_q_itemsChanged(int index, int count, const QVector<int>
         QVector<Compositor::Change> changes;
         d->m_compositor.listItemsChanged(&d->m_adaptorModel, index, count, &changes);
         d->itemsChanged(changes);
+        if (d->isSortedOrFiltered())
+            d->updateSortAndFilter(itemsGroupIndexes(changes));
         d->emitChanges();
     }
 }
@@ -1563,6 +2101,8 @@ void QQmlDelegateModel::_q_itemsInserted(int index, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsInserted(&d->m_adaptorModel, index, count, &inserts);
     d->itemsInserted(inserts);
+    if (d->isSortedOrFiltered())
+        d->updateSortAndFilter(itemsGroupIndexes(inserts));
     d->emitChanges();
 }
 
@@ -1780,6 +2320,8 @@ void QQmlDelegateModel::_q_itemsMoved(int from, int to, int count)
     QVector<Compositor::Insert> inserts;
     d->m_compositor.listItemsMoved(&d->m_adaptorModel, from, to, count, &removes, &inserts);
     d->itemsMoved(removes, inserts);
+    if (d->isSortedOrFiltered())
+        d->updateSortAndFilter(itemsGroupIndexes(inserts));
     d->emitChanges();
 }
 
@@ -1876,6 +2418,8 @@ void QQmlDelegateModel::_q_modelReset()
         if (d->m_count)
             d->m_compositor.listItemsInserted(&d->m_adaptorModel, 0, d->m_count, &inserts);
         d->itemsMoved(removes, inserts);
+        if (d->isSortedOrFiltered())
+            d->updateSortAndFilter(allIndexes(d->m_count));
         d->m_reset = true;
 
         if (d->m_adaptorModel.canFetchMore())
@@ -2918,6 +3462,163 @@ void QQmlDelegateModelGroup::setDefaultInclude(bool include)
     }
 }
 
+/*!
+    \qmlproperty function QtQml.Models::DelegateModelGroup::filter
+    \since 6.5
+
+    This property holds a function that decides which items of the
+    \l {DelegateModel::items}{items} group are members of this group.
+
+    The function is called with the same object that \l get() returns for
+    an item of the items group, and the item is a member of this group if
+    it returns \c true. It is called for all items when the filter is set,
+    and afterwards only for items that are inserted, changed or moved in
+    the model:
+
+    \code
+    DelegateModel {
+        groups: DelegateModelGroup {
+            name: "affordable"
+            filter: item => item.model.cost < 5
+        }
+        filterOnGroup: "affordable"
+    }
+    \endcode
+
+    When the filter is cleared, a group that \l includeByDefault contains
+    all items again, while other groups keep their current members.
+
+    The filter cannot be set on the items and persistedItems groups.
+*/
+QJSValue QQmlDelegateModelGroup::filter() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->filter;
+}
+
+void QQmlDelegateModelGroup::setFilter(const QJSValue &filter)
+{
+    Q_D(QQmlDelegateModelGroup);
+    if (d->filter.strictlyEquals(filter))
+        return;
+    if (d->group == Compositor::Default || d->group == Compositor::Persisted) {
+        qmlWarning(this) << tr("filter: cannot filter the %1 group").arg(d->name);
+        return;
+    }
+
+    const bool wasFiltered = d->isFiltered();
+    d->filter = filter;
+    if (wasFiltered && !d->isFiltered())
+        d->filterCleared();
+    else
+        d->sortOrFilterChanged();
+    emit filterChanged();
+}
+
+/*!
+    \qmlproperty string QtQml.Models::DelegateModelGroup::sortRole
+    \since 6.5
+
+    This property holds the model role by which the items of this group are
+    sorted. If it is empty, which is the default, the items keep the order
+    of the model.
+
+    Only items that are inserted, changed or moved in the model are put
+    into place again, so that single updates do not sort the whole group.
+    As all groups share the order of their items, sorting a group also
+    changes the order of the items in the other groups.
+
+    \sa sortOrder
+*/
+QString QQmlDelegateModelGroup::sortRole() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->sortRole;
+}
+
+void QQmlDelegateModelGroup::setSortRole(const QString &role)
+{
+    Q_D(QQmlDelegateModelGroup);
+    if (d->sortRole == role)
+        return;
+
+    const bool wasSorted = d->isSorted();
+    d->sortRole = role;
+    if (wasSorted && !d->isSorted())
+        d->sortCleared();
+    else
+        d->sortOrFilterChanged();
+    emit sortRoleChanged();
+}
+
+/*!
+    \qmlproperty enumeration QtQml.Models::DelegateModelGroup::sortOrder
+    \since 6.5
+
+    This property holds the order in which the items are sorted by
+    \l sortRole. It is either \c Qt.AscendingOrder, the default, or
+    \c Qt.DescendingOrder.
+*/
+Qt::SortOrder QQmlDelegateModelGroup::sortOrder() const
+{
+    Q_D(const QQmlDelegateModelGroup);
+    return d->sortOrder;
+}
+
+void QQmlDelegateModelGroup::setSortOrder(Qt::SortOrder order)
+{
+    Q_D(QQmlDelegateModelGroup);
+    if (d->sortOrder == order)
+        return;
+
+    d->sortOrder = order;
+    d->sortOrFilterChanged();
+    emit sortOrderChanged();
+}
+
+QQmlDelegateModelPrivate *QQmlDelegateModelGroupPrivate::completeModel() const
+{
+    if (!model)
+        return nullptr;
+    QQmlDelegateModelPrivate *modelPrivate = QQmlDelegateModelPrivate::get(model);
+    return modelPrivate->m_complete ? modelPrivate : nullptr;
+}
+
+void QQmlDelegateModelGroupPrivate::sortOrFilterChanged()
+{
+    QQmlDelegateModelPrivate *modelPrivate = completeModel();
+    if (!modelPrivate)
+        return;
+
+    modelPrivate->updateSortAndFilter(
+            allIndexes(modelPrivate->m_compositor.count(Compositor::Default)));
+    modelPrivate->emitChanges();
+}
+
+void QQmlDelegateModelGroupPrivate::filterCleared()
+{
+    QQmlDelegateModelPrivate *modelPrivate = completeModel();
+    if (!modelPrivate || !defaultInclude)
+        return;
+
+    QVector<Compositor::Insert> inserts;
+    modelPrivate->m_compositor.setFlags(
+            Compositor::Default, 0, modelPrivate->m_compositor.count(Compositor::Default),
+            1 << group, &inserts);
+    modelPrivate->itemsInserted(inserts);
+    modelPrivate->emitChanges();
+}
+
+void QQmlDelegateModelGroupPrivate::sortCleared()
+{
+    QQmlDelegateModelPrivate *modelPrivate = completeModel();
+    if (!modelPrivate)
+        return;
+
+    modelPrivate->restoreModelOrder();
+    modelPrivate->emitChanges();
+}
+
 /*!
     \qmlmethod object QtQml.Models::DelegateModelGroup::get(int index)
 
@@ -2972,13 +3673,18 @@ QJSValue QQmlDelegateModelGroup::get(int index)
         model->m_compositor.setFlags(it, 1, Compositor::CacheFlag);
     }
 
-    if (model->m_cacheMetaType->modelItemProto.isUndefined())
-        model->m_cacheMetaType->initializePrototype();
-    QV4::ExecutionEngine *v4 = model->m_cacheMetaType->v4Engine;
+    return model->itemObject(cacheItem);
+}
+
+QJSValue QQmlDelegateModelPrivate::itemObject(QQmlDelegateModelItem *cacheItem)
+{
+    if (m_cacheMetaType->modelItemProto.isUndefined())
+        m_cacheMetaType->initializePrototype();
+    QV4::ExecutionEngine *v4 = m_cacheMetaType->v4Engine;
     QV4::Scope scope(v4);
     ++cacheItem->scriptRef;
     QV4::ScopedObject o(scope, v4->memoryManager->allocate<QQmlDelegateModelItemObject>(cacheItem));
-    QV4::ScopedObject p(scope, model->m_cacheMetaType->modelItemProto.value());
+    QV4::ScopedObject p(scope, m_cacheMetaType->modelItemProto.value());
     o->setPrototypeOf(p);
 
     return QJSValuePrivate::fromReturnedValue(o->asReturnedValue());
@@ -3694,6 +4400,11 @@ QQmlIncubator::Status QQmlPartsModel::incubationStatus(int index)
     return QQmlIncubator::Ready;
 }
 
+void QQmlPartsModel::setIncubationPriority(QQmlIncubatorPrivate::Priority priority)
+{
+    QQmlDelegateModelPrivate::get(m_model)->m_incubationPriority = priority;
+}
+
 int QQmlPartsModel::indexOf(QObject *item, QObject *) const
 {
     auto it = m_packaged.find(item);
@@ -3744,7 +4455,21 @@ void QQmlPartsModel::emitModelUpdated(const QQmlChangeSet &changeSet, bool reset
     }
 }
 
-void QQmlReusableDelegateModelItemsPool::insertItem(QQmlDelegateModelItem *modelItem)
+/*!
+    \internal
+    Returns the maximum number of items that can rest in a reusable item pool at
+    once. It is unlimited by default, and can be set with the
+    \c QML_DELEGATE_POOL_LIMIT environment variable. The variable is read when
+    the pool is created.
+*/
+int QQmlReusableDelegateModelItemsPool::maximumPooledItems()
+{
+    bool ok = false;
+    const int limit = qEnvironmentVariableIntValue("QML_DELEGATE_POOL_LIMIT", &ok);
+    return ok && limit >= 0 ? limit : std::numeric_limits<int>::max();
+}
+
+bool QQmlReusableDelegateModelItemsPool::insertItem(QQmlDelegateModelItem *modelItem)
 {
     // Currently, the only way for a view to reuse items is to call release()
     // in the model class with the second argument explicitly set to
@@ -3788,13 +4513,25 @@ void QQmlReusableDelegateModelItemsPool::insertItem(QQmlDelegateModelItem *model
     // which means 1 for a list view and 2 for a table view. If you specify 0,
     // all items will be drained.
 
+    // Since pooled items stay alive, the number of items in the pool is
+    // capped by maximumSize(). If the pool is full, this function
+    // returns false, and the caller should destroy the item instead.
+
     Q_ASSERT(!modelItem->incubationTask);
     Q_ASSERT(!modelItem->isObjectReferenced());
     Q_ASSERT(modelItem->object);
     Q_ASSERT(modelItem->delegate);
 
+    if (m_size >= m_maximumSize) {
+        qCDebug(lcItemViewDelegateRecycling)
+                << "pool full, not pooling item:" << modelItem
+                << "delegate:" << modelItem->delegate;
+        return false;
+    }
+
     modelItem->poolTime = 0;
-    m_reusableItemsPool.append(modelItem);
+    m_reusableItemsPool[modelItem->delegate].append(modelItem);
+    ++m_size;
 
     qCDebug(lcItemViewDelegateRecycling)
             << "item:" << modelItem
@@ -3802,18 +4539,20 @@ void QQmlReusableDelegateModelItemsPool::insertItem(QQmlDelegateModelItem *model
             << "index:" << modelItem->modelIndex()
             << "row:" << modelItem->modelRow()
             << "column:" << modelItem->modelColumn()
-            << "pool size:" << m_reusableItemsPool.size();
+            << "pool size:" << m_size;
+    return true;
 }
 
 QQmlDelegateModelItem *QQmlReusableDelegateModelItemsPool::takeItem(const QQmlComponent *delegate, int newIndexHint)
 {
     // Find the oldest item in the pool that was made from the same delegate as
     // the given argument, remove it from the pool, and return it.
-    for (auto it = m_reusableItemsPool.begin(); it != m_reusableItemsPool.end(); ++it) {
-        if ((*it)->delegate != delegate)
-            continue;
-        auto modelItem = *it;
-        m_reusableItemsPool.erase(it);
+    const auto it = m_reusableItemsPool.find(delegate);
+    if (it != m_reusableItemsPool.end()) {
+        auto modelItem = it->takeFirst();
+        if (it->isEmpty())
+            m_reusableItemsPool.erase(it);
+        --m_size;
 
         qCDebug(lcItemViewDelegateRecycling)
                 << "item:" << modelItem
@@ -3822,7 +4561,7 @@ QQmlDelegateModelItem *QQmlReusableDelegateModelItemsPool::takeItem(const QQmlCo
                 << "old row:" << modelItem->modelRow()
                 << "old column:" << modelItem->modelColumn()
                 << "new index:" << newIndexHint
-                << "pool size:" << m_reusableItemsPool.size();
+                << "pool size:" << m_size;
 
         return modelItem;
     }
@@ -3830,7 +4569,7 @@ QQmlDelegateModelItem *QQmlReusableDelegateModelItemsPool::takeItem(const QQmlCo
     qCDebug(lcItemViewDelegateRecycling)
             << "no available item for delegate:" << delegate
             << "new index:" << newIndexHint
-            << "pool size:" << m_reusableItemsPool.size();
+            << "pool size:" << m_size;
 
     return nullptr;
 }
@@ -3843,20 +4582,28 @@ void QQmlReusableDelegateModelItemsPool::drain(int maxPoolTime, std::function<vo
     // will increase. If poolTime is equal to, or exceeds, maxPoolTime, it will be removed
     // from the pool and released. This way, the view can tweak a bit for how long
     // items should stay in "circulation", even if they are not recycled right away.
-    qCDebug(lcItemViewDelegateRecycling) << "pool size before drain:" << m_reusableItemsPool.size();
-
-    for (auto it = m_reusableItemsPool.begin(); it != m_reusableItemsPool.end();) {
-        auto modelItem = *it;
-        modelItem->poolTime++;
-        if (modelItem->poolTime <= maxPoolTime) {
-            ++it;
-        } else {
-            it = m_reusableItemsPool.erase(it);
-            releaseItem(modelItem);
+    qCDebug(lcItemViewDelegateRecycling) << "pool size before drain:" << m_size;
+
+    QList<QQmlDelegateModelItem *> releasedItems;
+    for (auto pool = m_reusableItemsPool.begin(); pool != m_reusableItemsPool.end();) {
+        for (auto it = pool->begin(); it != pool->end();) {
+            auto modelItem = *it;
+            modelItem->poolTime++;
+            if (modelItem->poolTime <= maxPoolTime) {
+                ++it;
+            } else {
+                it = pool->erase(it);
+                releasedItems.append(modelItem);
+            }
         }
+        pool = pool->isEmpty() ? m_reusableItemsPool.erase(pool) : std::next(pool);
     }
 
-    qCDebug(lcItemViewDelegateRecycling) << "pool size after drain:" << m_reusableItemsPool.size();
+    m_size -= int(releasedItems.size());
+    for (QQmlDelegateModelItem *modelItem : std::as_const(releasedItems))
+        releaseItem(modelItem);
+
+    qCDebug(lcItemViewDelegateRecycling) << "pool size after drain:" << m_size;
 }
 
 //============================================================================
@@ -48,6 +48,7 @@ class Q_QMLMODELS_PRIVATE_EXPORT QQmlDelegateModel : public QQmlInstanceModel, p
     Q_PROPERTY(QQmlListProperty<QQmlDelegateModelGroup> groups READ groups CONSTANT)
     Q_PROPERTY(QObject *parts READ parts CONSTANT)
     Q_PROPERTY(QVariant rootIndex READ rootIndex WRITE setRootIndex NOTIFY rootIndexChanged)
+    Q_PROPERTY(QString keyRole READ keyRole WRITE setKeyRole NOTIFY keyRoleChanged REVISION(6, 5))
     Q_CLASSINFO("DefaultProperty", "delegate")
     QML_NAMED_ELEMENT(DelegateModel)
     QML_ADDED_IN_VERSION(2, 1)
@@ -71,6 +72,9 @@ public:
     QVariant rootIndex() const;
     void setRootIndex(const QVariant &root);
 
+    QString keyRole() const;
+    void setKeyRole(const QString &role);
+
     Q_INVOKABLE QVariant modelIndex(int idx) const;
     Q_INVOKABLE QVariant parentModelIndex() const;
 
@@ -86,6 +90,8 @@ public:
     void drainReusableItemsPool(int maxPoolTime) override;
     int poolSize() override;
 
+    void setIncubationPriority(QQmlIncubatorPrivate::Priority priority) override;
+
     int indexOf(QObject *object, QObject *objectContext) const override;
 
     QString filterGroup() const;
@@ -108,6 +114,7 @@ Q_SIGNALS:
     void defaultGroupsChanged();
     void rootIndexChanged();
     void delegateChanged();
+    Q_REVISION(6, 5) void keyRoleChanged();
 
 private Q_SLOTS:
     void _q_itemsChanged(int index, int count, const QVector<int> &roles);
@@ -138,6 +145,9 @@ class Q_QMLMODELS_PRIVATE_EXPORT QQmlDelegateModelGroup : public QObject
     Q_PROPERTY(int count READ count NOTIFY countChanged)
     Q_PROPERTY(QString name READ name WRITE setName NOTIFY nameChanged)
     Q_PROPERTY(bool includeByDefault READ defaultInclude WRITE setDefaultInclude NOTIFY defaultIncludeChanged)
+    Q_PROPERTY(QJSValue filter READ filter WRITE setFilter NOTIFY filterChanged REVISION(6, 5))
+    Q_PROPERTY(QString sortRole READ sortRole WRITE setSortRole NOTIFY sortRoleChanged REVISION(6, 5))
+    Q_PROPERTY(Qt::SortOrder sortOrder READ sortOrder WRITE setSortOrder NOTIFY sortOrderChanged REVISION(6, 5))
     QML_NAMED_ELEMENT(DelegateModelGroup)
     QML_ADDED_IN_VERSION(2, 1)
 public:
@@ -153,6 +163,15 @@ public:
     bool defaultInclude() const;
     void setDefaultInclude(bool include);
 
+    QJSValue filter() const;
+    void setFilter(const QJSValue &filter);
+
+    QString sortRole() const;
+    void setSortRole(const QString &role);
+
+    Qt::SortOrder sortOrder() const;
+    void setSortOrder(Qt::SortOrder order);
+
     Q_INVOKABLE QJSValue get(int index);
 
 public Q_SLOTS:
@@ -170,6 +189,9 @@ Q_SIGNALS:
     void nameChanged();
     void defaultIncludeChanged();
     void changed(const QJSValue &removed, const QJSValue &inserted);
+    Q_REVISION(6, 5) void filterChanged();
+    Q_REVISION(6, 5) void sortRoleChanged();
+    Q_REVISION(6, 5) void sortOrderChanged();
 private:
     Q_DECLARE_PRIVATE(QQmlDelegateModelGroup)
 };
@@ -165,14 +165,18 @@ void QV4::Heap::QQmlDelegateModelItemObject::init(QQmlDelegateModelItem *item)
 class QQmlReusableDelegateModelItemsPool
 {
 public:
-    void insertItem(QQmlDelegateModelItem *modelItem);
+    bool insertItem(QQmlDelegateModelItem *modelItem);
     QQmlDelegateModelItem *takeItem(const QQmlComponent *delegate, int newIndexHint);
-    void reuseItem(QQmlDelegateModelItem *item, int newModelIndex);
     void drain(int maxPoolTime, std::function<void(QQmlDelegateModelItem *cacheItem)> releaseItem);
-    int size() { return m_reusableItemsPool.size(); }
+    int size() { return m_size; }
+    int maximumSize() const { return m_maximumSize; }
+
+    static int maximumPooledItems();
 
 private:
-    QList<QQmlDelegateModelItem *> m_reusableItemsPool;
+    QHash<const QQmlComponent *, QList<QQmlDelegateModelItem *>> m_reusableItemsPool;
+    int m_size = 0;
+    int m_maximumSize = maximumPooledItems();
 };
 
 class QQmlDelegateModelPrivate;
@@ -233,11 +237,21 @@ public:
     bool parseGroupArgs(
             QQmlV4Function *args, Compositor::Group *group, int *index, int *count, int *groups) const;
 
+    bool isFiltered() const { return filter.isCallable(); }
+    bool isSorted() const { return !sortRole.isEmpty(); }
+    QQmlDelegateModelPrivate *completeModel() const;
+    void sortOrFilterChanged();
+    void filterCleared();
+    void sortCleared();
+
     Compositor::Group group;
     QPointer<QQmlDelegateModel> model;
     QQmlDelegateModelGroupEmitterList emitters;
     QQmlChangeSet changeSet;
     QString name;
+    QJSValue filter;
+    QString sortRole;
+    Qt::SortOrder sortOrder = Qt::AscendingOrder;
     bool defaultInclude;
 };
 
@@ -305,6 +319,20 @@ public:
 
     int adaptorModelCount() const;
 
+    bool isSortedOrFiltered() const;
+    void updateSortAndFilter(const QList<int> &indexes);
+    QJSValue filterItem(int index);
+    bool filterAccepts(QQmlDelegateModelGroupPrivate *group, const QJSValue &item);
+    bool sortGroup(QQmlDelegateModelGroupPrivate *group, const QList<int> *positions);
+    bool moveToOrder(Compositor::Group group, const QList<int> &order);
+    void restoreModelOrder();
+    void moveInGroup(Compositor::Group group, int from, int to);
+    QJSValue itemObject(QQmlDelegateModelItem *cacheItem);
+
+    bool listKeys(QList<QString> *keys) const;
+    void applyListDiff(const QQmlListAccessor &oldList, const QList<QString> &oldKeys,
+                       const QList<QString> &newKeys);
+
     static void group_append(QQmlListProperty<QQmlDelegateModelGroup> *property, QQmlDelegateModelGroup *group);
     static qsizetype group_count(QQmlListProperty<QQmlDelegateModelGroup> *property);
     static QQmlDelegateModelGroup *group_at(QQmlListProperty<QQmlDelegateModelGroup> *property, qsizetype index);
@@ -326,9 +354,11 @@ public:
     QList<QQmlDelegateModelItem *> m_cache;
     QQmlReusableDelegateModelItemsPool m_reusableItemsPool;
     QList<QQDMIncubationTask *> m_finishedIncubating;
+    QQmlIncubatorPrivate::Priority m_incubationPriority = QQmlIncubatorPrivate::NormalPriority;
     QList<QByteArray> m_watchedRoles;
 
     QString m_filterGroup;
+    QString m_keyRole;
 
     int m_count;
     int m_groupCount;
@@ -373,6 +403,7 @@ public:
     QList<QByteArray> watchedRoles() const { return m_watchedRoles; }
     void setWatchedRoles(const QList<QByteArray> &roles) override;
     QQmlIncubator::Status incubationStatus(int index) override;
+    void setIncubationPriority(QQmlIncubatorPrivate::Priority priority) override;
 
     int indexOf(QObject *item, QObject *objectContext) const override;
 
@@ -5,6 +5,8 @@
 
 #include <QtCore/qvarlengtharray.h>
 
+#include <algorithm>
+
 //#define QT_QML_VERIFY_MINIMAL
 //#define QT_QML_VERIFY_INTEGRITY
 
@@ -306,6 +308,7 @@ void QQmlListCompositor::setGroupCount(int count)
     m_groupCount = count;
     m_end = iterator(&m_ranges, 0, Default, m_groupCount);
     m_cacheIt = m_end;
+    m_rangeIndex.clear();
 }
 
 /*!
@@ -327,7 +330,10 @@ QQmlListCompositor::iterator QQmlListCompositor::find(Group group, int index)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< group << index)
     Q_ASSERT(index >=0 && index < count(group));
-    if (m_cacheIt == m_end) {
+    const int distance = m_cacheIt == m_end ? index : qAbs(index - m_cacheIt.index[group]);
+    if (distance > MaximumUnindexedDistance || isIndexed(group, index)) {
+        m_cacheIt = findIndexed(group, index);
+    } else if (m_cacheIt == m_end) {
         m_cacheIt = iterator(m_ranges.next, 0, group, m_groupCount);
         m_cacheIt += index;
     } else {
@@ -341,6 +347,100 @@ QQmlListCompositor::iterator QQmlListCompositor::find(Group group, int index)
     return m_cacheIt;
 }
 
+/*!
+    \internal
+    Returns whether the range containing the item at \a index in a \a group is covered by the
+    range index.
+*/
+
+bool QQmlListCompositor::isIndexed(Group group, int index) const
+{
+    if (m_rangeIndex.isEmpty())
+        return false;
+    const RangeIndex &last = m_rangeIndex.last();
+    return index < last.index[group] + (last.range->inGroup(group) ? last.range->count : 0);
+}
+
+/*!
+    \internal
+    Returns an iterator representing the item at \a index in a \a group, using a binary search
+    over the start indexes of the ranges.
+
+    The index of range start positions covers the ranges from the start of the list up to some
+    point, and is extended on demand by walking the ranges after it.  Modifications only discard
+    the part of the index from the modified ranges onwards, so lookups in front of a change stay
+    cheap, and lookups after it only walk the ranges which aren't indexed yet.  Lookups close to
+    the last found item walk the list of ranges from there instead.
+*/
+
+QQmlListCompositor::iterator QQmlListCompositor::findIndexed(Group group, int index)
+{
+    if (!isIndexed(group, index)) {
+        iterator it(m_ranges.next, 0, Default, m_groupCount);
+        if (!m_rangeIndex.isEmpty()) {
+            const RangeIndex &last = m_rangeIndex.last();
+            *it = last.range;
+            for (int i = 0; i < m_groupCount; ++i)
+                it.index[i] = last.index[i];
+            it.incrementIndexes(it->count);
+            *it = it->next;
+        }
+        for (; *it != &m_ranges; *it = it->next) {
+            RangeIndex entry;
+            entry.range = *it;
+            entry.position = 0;
+            for (int i = 0; i < m_groupCount; ++i) {
+                entry.index[i] = it.index[i];
+                entry.position += it.index[i];
+            }
+            m_rangeIndex.append(entry);
+            it.incrementIndexes(it->count);
+            if (it->inGroup(group) && it.index[group] > index)
+                break;
+        }
+    }
+
+    // The first range which ends after the index is also the first range containing it.
+    const auto entry = std::upper_bound(
+            m_rangeIndex.cbegin(), m_rangeIndex.cend(), index,
+            [group](int value, const RangeIndex &start) {
+        return value < start.index[group] + (start.range->inGroup(group) ? start.range->count : 0);
+    });
+    Q_ASSERT(entry != m_rangeIndex.cend());
+
+    iterator it(entry->range, 0, group, m_groupCount);
+    for (int i = 0; i < m_groupCount; ++i)
+        it.index[i] = entry->index[i];
+    it.offset = index - entry->index[group];
+    it.incrementIndexes(it.offset);
+    return it;
+}
+
+/*!
+    \internal
+    Discards the part of the range index which a modification of the range at \a it may affect.
+
+    Modifications can change the range at an iterator and the ones after it, and may join the
+    range before it with those.  The start indexes of the ranges in front of that don't change.
+*/
+
+void QQmlListCompositor::invalidateRangeIndex(const iterator &it)
+{
+    if (m_rangeIndex.isEmpty())
+        return;
+
+    int position = 0;
+    for (int i = 0; i < m_groupCount; ++i)
+        position += it.index[i] - (it->inGroup(i) ? it.offset : 0);
+
+    // Ranges which are in no group have the same position as the range after them, so this
+    // may also discard some ranges in front of the previous one, which is harmless.
+    const auto entry = std::lower_bound(
+            m_rangeIndex.cbegin(), m_rangeIndex.cend(), position,
+            [](const RangeIndex &start, int value) { return start.position < value; });
+    m_rangeIndex.resize(qMax<qsizetype>(0, (entry - m_rangeIndex.cbegin()) - 1));
+}
+
 /*!
     Returns an iterator representing the item at \a index in a \a group.
 
@@ -424,6 +524,7 @@ QQmlListCompositor::iterator QQmlListCompositor::insert(
         iterator before, void *list, int index, int count, uint flags, QVector<Insert> *inserts)
 {
     QT_QML_TRACE_LISTCOMPOSITOR(<< before << list << index << count << flags)
+    invalidateRangeIndex(before);
     if (inserts) {
         inserts->append(Insert(before, count, flags & GroupMask));
     }
@@ -495,6 +596,8 @@ void QQmlListCompositor::setFlags(
     if (!flags || !count)
         return;
 
+    invalidateRangeIndex(from);
+
     if (from != group) {
         // Skip to the next full range if the start one is not a member of the target group.
         from.incrementIndexes(from->count - from.offset);
@@ -605,6 +708,8 @@ void QQmlListCompositor::clearFlags(
     if (!flags || !count)
         return;
 
+    invalidateRangeIndex(from);
+
     const bool clearCache = flags & CacheFlag;
 
     if (from != group) {
@@ -744,6 +849,12 @@ void QQmlListCompositor::move(
 
     // Find the position of the first item to move.
     iterator fromIt = find(fromGroup, from);
+    if (to < fromIt.index[toGroup]) {
+        // The items are moved in front of their current position.
+        invalidateRangeIndex(find(toGroup, to));
+    } else {
+        invalidateRangeIndex(fromIt);
+    }
 
     if (fromIt != moveGroup) {
         // If the range at the from index doesn't contain items from the move group; skip
@@ -908,6 +1019,7 @@ void QQmlListCompositor::clear()
     for (Range *range = m_ranges.next; range != &m_ranges; range = erase(range)) {}
     m_end = iterator(m_ranges.next, 0, Default, m_groupCount);
     m_cacheIt = m_end;
+    m_rangeIndex.clear();
 }
 
 void QQmlListCompositor::listItemsInserted(
@@ -934,6 +1046,7 @@ void QQmlListCompositor::listItemsInserted(
                     || (offset == 0 && it->prepend())
                     || (offset == it->count && it->append())) {
                 // The insert index is within the current range.
+                invalidateRangeIndex(it);
                 if (it->prepend()) {
                     // The range has the prepend flag set so we insert new items into the range.
                     uint flags = m_defaultFlags;
@@ -1055,6 +1168,7 @@ void QQmlListCompositor::listItemsRemoved(
             int itemsRemoved = removal->count;
             if (relativeIndex + removal->count > 0 && relativeIndex < it->count) {
                 // If the current range intersects the remove; remove the intersecting items.
+                invalidateRangeIndex(it);
                 const int offset = qMax(0, relativeIndex);
                 int removeCount = qMin(it->count, relativeIndex + removal->count) - offset;
                 it->count -= removeCount;
@@ -1176,6 +1290,7 @@ void QQmlListCompositor::listItemsRemoved(
                         && it->previous->end() == it->index
                         && it->previous->flags == (it->flags & ~AppendFlag)) {
                     // Compress ranges made continuous by the removal of separating ranges.
+                    invalidateRangeIndex(it);
                     it.decrementIndexes(it->previous->count);
                     it->previous->count += it->count;
                     it->previous->flags = it->flags;
@@ -1185,6 +1300,7 @@ void QQmlListCompositor::listItemsRemoved(
         }
         if (it->flags == CacheFlag && it->next->flags == CacheFlag && it->next->list == it->list) {
             // Compress consecutive cache only ranges.
+            invalidateRangeIndex(it);
             it.index[Cache] += it->next->count;
             it->count += it->next->count;
             erase(it->next);
@@ -233,14 +233,29 @@ public:
             QVector<QQmlChangeSet::Change> *inserts);
 
 private:
+    // Lookups which would walk more items than this from the last found item use the range index.
+    enum { MaximumUnindexedDistance = 64 };
+
+    struct RangeIndex
+    {
+        Range *range;
+        int index[MaximumGroupCount];
+        int position; // The sum of index, which never decreases along the list of ranges.
+    };
+
     Range m_ranges;
     iterator m_end;
     iterator m_cacheIt;
+    QVector<RangeIndex> m_rangeIndex;
     int m_groupCount;
     int m_defaultFlags;
     int m_removeFlags;
     int m_moveId;
 
+    bool isIndexed(Group group, int index) const;
+    iterator findIndexed(Group group, int index);
+    void invalidateRangeIndex(const iterator &it);
+
     inline Range *insert(Range *before, void *list, int index, int count, uint flags);
     inline Range *erase(Range *range);
 
@@ -362,6 +362,11 @@ bool ListModel::sync(ListModel *src, ListModel *target)
 
     QQmlListModel *targetModel = target->m_modelCache;
 
+    // If the source was populated from scratch, none of its elements exist in the target.
+    // Replace the contents in one go instead of reporting every row separately.
+    if (elementHash.size() == target->elements.count() + src->elements.count())
+        return replace(src, target);
+
     // Get list of elements that are in the target but no longer in the source. These get deleted first.
     int rowsRemoved = 0;
     for (int i = 0 ; i < target->elements.count() ; ++i) {
@@ -376,7 +381,7 @@ bool ListModel::sync(ListModel *src, ListModel *target)
             if (targetModel)
                 targetModel->beginRemoveRows(QModelIndex(), i, i);
             s.target->destroy(target->m_layout);
-            target->elements.removeOne(s.target);
+            target->elements.remove(i);
             delete s.target;
             if (targetModel)
                 targetModel->endRemoveRows();
@@ -466,6 +471,54 @@ bool ListModel::sync(ListModel *src, ListModel *target)
     return hasChanges;
 }
 
+/*!
+    \internal
+    Replaces all elements of \a target with copies of the elements of \a src,
+    which has no elements in common with it. The model is reset rather than
+    notified row by row, or, if \a target was empty, the new elements are
+    reported as one inserted range.
+*/
+bool ListModel::replace(ListModel *src, ListModel *target)
+{
+    const int targetCount = target->elements.count();
+    const int srcCount = src->elements.count();
+    if (targetCount == 0 && srcCount == 0)
+        return false;
+
+    QQmlListModel *targetModel = target->m_modelCache;
+    if (targetModel) {
+        if (targetCount == 0)
+            targetModel->beginInsertRows(QModelIndex(), 0, srcCount - 1);
+        else
+            targetModel->beginResetModel();
+    }
+
+    for (int i = 0; i < targetCount; ++i) {
+        ListElement *e = target->elements.at(i);
+        e->destroy(target->m_layout);
+        delete e;
+    }
+    target->elements.clear();
+
+    ListLayout::sync(src->m_layout, target->m_layout);
+
+    target->elements.reserve(srcCount);
+    for (int i = 0; i < srcCount; ++i) {
+        ListElement *srcElement = src->elements.at(i);
+        ListElement *targetElement = new ListElement(srcElement->getUid());
+        ListElement::sync(srcElement, src->m_layout, targetElement, target->m_layout);
+        target->elements.append(targetElement);
+    }
+
+    if (targetModel) {
+        if (targetCount == 0)
+            targetModel->endInsertRows();
+        else
+            targetModel->endResetModel();
+    }
+    return true;
+}
+
 ListModel::ListModel(ListLayout *layout, QQmlListModel *modelCache) : m_layout(layout), m_modelCache(modelCache)
 {
 }
@@ -494,6 +547,28 @@ void ListModel::insertElement(int index)
     updateCacheIndices(index);
 }
 
+/*!
+    \internal
+    Inserts \a count empty elements at \a index with a single move of the
+    element table, instead of shifting it once per element.
+*/
+void ListModel::insertElements(int index, int count)
+{
+    if (count <= 0)
+        return;
+
+    const int oldCount = elements.count();
+    if (oldCount + count > elements.capacity())
+        elements.reserve(qMax(oldCount + count, 2 * elements.capacity()));
+
+    elements.insertBlank(index, count);
+    for (int i = 0; i < count; ++i)
+        elements[index + i] = new ListElement;
+
+    if (index < oldCount)
+        updateCacheIndices(index + count);
+}
+
 void ListModel::move(int from, int to, int n)
 {
     if (from > to) {
@@ -518,6 +593,10 @@ void ListModel::move(int from, int to, int n)
 
 void ListModel::newElement(int index)
 {
+    // Grow geometrically, so that appending row by row stays linear.
+    if (elements.count() == elements.capacity())
+        elements.reserve(qMax(4, 2 * elements.capacity()));
+
     ListElement *e = new ListElement;
     elements.insert(index, e);
 }
@@ -2200,6 +2279,34 @@ bool QQmlListModel::sync(QQmlListModel *src, QQmlListModel *target)
         }
     }
 
+    // If the source was populated from scratch, replace the contents in one go.
+    const int targetCount = target->m_modelObjects.size();
+    const int srcCount = src->m_modelObjects.size();
+    if (elementHash.size() == targetCount + srcCount) {
+        if (targetCount == 0 && srcCount == 0)
+            return false;
+
+        if (targetCount == 0)
+            target->beginInsertRows(QModelIndex(), 0, srcCount - 1);
+        else
+            target->beginResetModel();
+
+        qDeleteAll(target->m_modelObjects);
+        target->m_modelObjects.clear();
+        target->m_modelObjects.reserve(srcCount);
+        for (DynamicRoleModelNode *element : std::as_const(src->m_modelObjects)) {
+            DynamicRoleModelNode *targetElement = new DynamicRoleModelNode(target, element->getUid());
+            DynamicRoleModelNode::sync(element, targetElement);
+            target->m_modelObjects.append(targetElement);
+        }
+
+        if (targetCount == 0)
+            target->endInsertRows();
+        else
+            target->endResetModel();
+        return true;
+    }
+
     // Get list of elements that are in the target but no longer in the source. These get deleted first.
     int rowsRemoved = 0;
     for (int i = 0 ; i < target->m_modelObjects.size() ; ++i) {
@@ -2268,28 +2375,80 @@ bool QQmlListModel::sync(QQmlListModel *src, QQmlListModel *target)
 
 void QQmlListModel::emitItemsChanged(int index, int count, const QVector<int> &roles)
 {
-    if (count <= 0)
+    if (count <= 0 || !m_mainThread)
         return;
 
-    if (m_mainThread)
-        emit dataChanged(createIndex(index, 0), createIndex(index + count - 1, 0), roles);;
+    if (m_batch.depth > 0) {
+        // Merge into a single pending change, emitted when the batch ends
+        const int last = index + count - 1;
+        if (m_batch.firstChanged < 0) {
+            m_batch.firstChanged = index;
+            m_batch.lastChanged = last;
+        } else {
+            m_batch.firstChanged = qMin(m_batch.firstChanged, index);
+            m_batch.lastChanged = qMax(m_batch.lastChanged, last);
+        }
+
+        if (roles.isEmpty()) {
+            m_batch.allRolesChanged = true;
+            m_batch.changedRoles.clear();
+        } else if (!m_batch.allRolesChanged) {
+            for (int role : roles) {
+                if (!m_batch.changedRoles.contains(role))
+                    m_batch.changedRoles.append(role);
+            }
+        }
+        return;
+    }
+
+    emit dataChanged(createIndex(index, 0), createIndex(index + count - 1, 0), roles);
 }
 
 void QQmlListModel::emitItemsAboutToBeInserted(int index, int count)
 {
     Q_ASSERT(index >= 0 && count >= 0);
-    if (m_mainThread)
+    if (m_mainThread) {
+        flushBatchedChanges();
         beginInsertRows(QModelIndex(), index, index + count - 1);
+    }
 }
 
 void QQmlListModel::emitItemsInserted()
 {
     if (m_mainThread) {
         endInsertRows();
-        emit countChanged();
+        emitCountChanged();
     }
 }
 
+void QQmlListModel::emitCountChanged()
+{
+    if (m_batch.depth > 0)
+        m_batch.countChanged = true;
+    else
+        emit countChanged();
+}
+
+/*!
+    \internal
+    Emits the data changes collected during the current batch. Rows are
+    about to be inserted, removed or moved, or the batch has ended, so the
+    collected row range would no longer be valid afterwards.
+*/
+void QQmlListModel::flushBatchedChanges()
+{
+    if (m_batch.firstChanged < 0)
+        return;
+
+    const QModelIndex first = createIndex(m_batch.firstChanged, 0);
+    const QModelIndex last = createIndex(m_batch.lastChanged, 0);
+    const QVector<int> roles = std::exchange(m_batch.changedRoles, QVector<int>());
+    m_batch.firstChanged = -1;
+    m_batch.lastChanged = -1;
+    m_batch.allRolesChanged = false;
+    emit dataChanged(first, last, roles);
+}
+
 QQmlListModelWorkerAgent *QQmlListModel::agent()
 {
     if (m_agent)
@@ -2473,8 +2632,10 @@ void QQmlListModel::removeElements(int index, int removeCount)
     if (!removeCount)
         return;
 
-    if (m_mainThread)
+    if (m_mainThread) {
+        flushBatchedChanges();
         beginRemoveRows(QModelIndex(), index, index + removeCount - 1);
+    }
 
     QVector<std::function<void()>> toDestroy;
     if (m_dynamicRoles) {
@@ -2491,7 +2652,7 @@ void QQmlListModel::removeElements(int index, int removeCount)
 
     if (m_mainThread) {
         endRemoveRows();
-        emit countChanged();
+        emitCountChanged();
     }
     for (const auto &destroyer : toDestroy)
         destroyer();
@@ -2553,13 +2714,17 @@ void QQmlListModel::insert(QQmlV4Function *args)
 
             int objectArrayLength = objectArray->getLength();
             emitItemsAboutToBeInserted(index, objectArrayLength);
-            for (int i=0 ; i < objectArrayLength ; ++i) {
-                argObject = objectArray->get(i);
-
-                if (m_dynamicRoles) {
-                    m_modelObjects.insert(index+i, DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
-                } else {
-                    m_listModel->insert(index+i, argObject);
+            if (m_dynamicRoles) {
+                m_modelObjects.insert(index, objectArrayLength, nullptr);
+                for (int i=0 ; i < objectArrayLength ; ++i) {
+                    argObject = objectArray->get(i);
+                    m_modelObjects[index+i] = DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this);
+                }
+            } else {
+                m_listModel->insertElements(index, objectArrayLength);
+                for (int i=0 ; i < objectArrayLength ; ++i) {
+                    argObject = objectArray->get(i);
+                    m_listModel->set(index+i, argObject, ListModel::SetElement::WasJustInserted);
                 }
             }
             emitItemsInserted();
@@ -2581,6 +2746,50 @@ void QQmlListModel::insert(QQmlV4Function *args)
     }
 }
 
+/*!
+    \internal
+    Inserts one element per entry of \a values at \a index. Each entry is
+    expected to be a QVariantMap holding the roles of the new element. All
+    elements are added in one go and announced with a single insertion.
+*/
+void QQmlListModel::insert(int index, const QVariantList &values)
+{
+    if (index < 0 || index > count()) {
+        qmlWarning(this) << tr("insert: index %1 out of range").arg(index);
+        return;
+    }
+
+    const int valueCount = values.size();
+    if (valueCount == 0)
+        return;
+
+    emitItemsAboutToBeInserted(index, valueCount);
+    if (m_dynamicRoles) {
+        m_modelObjects.insert(index, valueCount, nullptr);
+        for (int i = 0; i < valueCount; ++i)
+            m_modelObjects[index + i] = DynamicRoleModelNode::create(values.at(i).toMap(), this);
+    } else {
+        m_listModel->insertElements(index, valueCount);
+        for (int i = 0; i < valueCount; ++i) {
+            const QVariantMap map = values.at(i).toMap();
+            for (auto it = map.cbegin(), end = map.cend(); it != end; ++it)
+                m_listModel->setOrCreateProperty(index + i, it.key(), it.value());
+        }
+    }
+    emitItemsInserted();
+}
+
+/*!
+    \internal
+    Appends one element per entry of \a values.
+
+    \sa insert()
+*/
+void QQmlListModel::append(const QVariantList &values)
+{
+    insert(count(), values);
+}
+
 /*!
     \qmlmethod ListModel::move(int from, int to, int n)
 
@@ -2604,8 +2813,10 @@ void QQmlListModel::move(int from, int to, int n)
         return;
     }
 
-    if (m_mainThread)
+    if (m_mainThread) {
+        flushBatchedChanges();
         beginMoveRows(QModelIndex(), from, from + n - 1, QModelIndex(), to > from ? to + n : to);
+    }
 
     if (m_dynamicRoles) {
 
@@ -2665,13 +2876,17 @@ void QQmlListModel::append(QQmlV4Function *args)
                 int index = count();
                 emitItemsAboutToBeInserted(index, objectArrayLength);
 
-                for (int i=0 ; i < objectArrayLength ; ++i) {
-                    argObject = objectArray->get(i);
-
-                    if (m_dynamicRoles) {
+                if (m_dynamicRoles) {
+                    m_modelObjects.reserve(index + objectArrayLength);
+                    for (int i=0 ; i < objectArrayLength ; ++i) {
+                        argObject = objectArray->get(i);
                         m_modelObjects.append(DynamicRoleModelNode::create(scope.engine->variantMapFromJS(argObject), this));
-                    } else {
-                        m_listModel->append(argObject);
+                    }
+                } else {
+                    m_listModel->insertElements(index, objectArrayLength);
+                    for (int i=0 ; i < objectArrayLength ; ++i) {
+                        argObject = objectArray->get(i);
+                        m_listModel->set(index+i, argObject, ListModel::SetElement::WasJustInserted);
                     }
                 }
 
@@ -2861,6 +3076,57 @@ void QQmlListModel::sync()
     qmlWarning(this) << "List sync() can only be called from a WorkerScript";
 }
 
+/*!
+    \qmlmethod ListModel::beginBatch()
+    \since 6.5
+
+    Starts collecting changes made to the model. Until the matching endBatch()
+    call, all changes made with set() and setProperty() are reported to views
+    as a single change covering the affected rows, and the count property
+    notifies at most once. This avoids updating views once per modified role
+    when many items change at the same time:
+
+    \code
+        fruitModel.beginBatch()
+        for (var i = 0; i < fruitModel.count; ++i)
+            fruitModel.setProperty(i, "cost", prices[i])
+        fruitModel.endBatch()
+    \endcode
+
+    Insertions, removals and moves are still reported as they happen, and
+    first report the changes collected so far. Batches can be nested; the
+    collected changes are reported when the outermost batch ends.
+
+    \sa endBatch()
+*/
+void QQmlListModel::beginBatch()
+{
+    ++m_batch.depth;
+}
+
+/*!
+    \qmlmethod ListModel::endBatch()
+    \since 6.5
+
+    Ends a batch started with beginBatch() and reports the collected changes.
+
+    \sa beginBatch()
+*/
+void QQmlListModel::endBatch()
+{
+    if (m_batch.depth == 0) {
+        qmlWarning(this) << tr("endBatch: no batch in progress");
+        return;
+    }
+
+    if (--m_batch.depth > 0)
+        return;
+
+    flushBatchedChanges();
+    if (std::exchange(m_batch.countChanged, false))
+        emit countChanged();
+}
+
 bool QQmlListModelParser::verifyProperty(const QQmlRefPointer<QV4::ExecutableCompilationUnit> &compilationUnit, const QV4::CompiledData::Binding *binding)
 {
     if (binding->type() >= QV4::CompiledData::Binding::Type_Object) {
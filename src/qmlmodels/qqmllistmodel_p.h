@@ -73,12 +73,17 @@ public:
     Q_INVOKABLE void setProperty(int index, const QString& property, const QVariant& value);
     Q_INVOKABLE void move(int from, int to, int count);
     Q_INVOKABLE void sync();
+    Q_REVISION(6, 5) Q_INVOKABLE void beginBatch();
+    Q_REVISION(6, 5) Q_INVOKABLE void endBatch();
 
     QQmlListModelWorkerAgent *agent();
 
     bool dynamicRoles() const { return m_dynamicRoles; }
     void setDynamicRoles(bool enableDynamicRoles);
 
+    void append(const QVariantList &values);
+    void insert(int index, const QVariantList &values);
+
 Q_SIGNALS:
     void countChanged();
 
@@ -117,6 +122,17 @@ private:
     QVector<class DynamicRoleModelNode *> m_modelObjects;
     QVector<QString> m_roles;
 
+    struct Batch
+    {
+        int depth = 0;
+        int firstChanged = -1;
+        int lastChanged = -1;
+        QVector<int> changedRoles;
+        bool allRolesChanged = false;
+        bool countChanged = false;
+    };
+    Batch m_batch;
+
     struct ElementSync
     {
         DynamicRoleModelNode *src = nullptr;
@@ -132,6 +148,8 @@ private:
     void emitItemsChanged(int index, int count, const QVector<int> &roles);
     void emitItemsAboutToBeInserted(int index, int count);
     void emitItemsInserted();
+    void emitCountChanged();
+    void flushBatchedChanges();
 
     void removeElements(int index, int removeCount);
 
@@ -402,10 +402,12 @@ public:
 
     int appendElement();
     void insertElement(int index);
+    void insertElements(int index, int count);
 
     void move(int from, int to, int n);
 
     static bool sync(ListModel *src, ListModel *target);
+    static bool replace(ListModel *src, ListModel *target);
 
     QObject *getOrCreateModelObject(QQmlListModel *model, int elementIndex);
 
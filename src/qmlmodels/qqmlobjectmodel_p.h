@@ -58,6 +58,8 @@ public:
     virtual void drainReusableItemsPool(int maxPoolTime) { Q_UNUSED(maxPoolTime); }
     virtual int poolSize() { return 0; }
 
+    virtual void setIncubationPriority(QQmlIncubatorPrivate::Priority priority) { Q_UNUSED(priority); }
+
     virtual int indexOf(QObject *object, QObject *objectContext) const = 0;
     virtual const QAbstractItemModel *abstractItemModel() const { return nullptr; }
 
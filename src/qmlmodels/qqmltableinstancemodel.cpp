@@ -182,8 +182,7 @@ QQmlInstanceModel::ReleaseFlags QQmlTableInstanceModel::release(QObject *object,
     // The item is not referenced by anyone
     m_modelItems.remove(modelItem->index);
 
-    if (reusable == Reusable) {
-        m_reusableItemsPool.insertItem(modelItem);
+    if (reusable == Reusable && m_reusableItemsPool.insertItem(modelItem)) {
         emit itemPooled(modelItem->index, modelItem->object);
         return QQmlInstanceModel::Pooled;
     }
@@ -84,6 +84,7 @@ void QQmlTreeModelToTableModel::clearModelData()
 {
     beginResetModel();
     m_items.clear();
+    invalidateItemIndexCache();
     m_expandedItems.clear();
     endResetModel();
 }
@@ -171,12 +172,40 @@ int QQmlTreeModelToTableModel::depthAtRow(int row) const
     return m_items.at(row).depth;
 }
 
+// Finding a row by scanning more items than this builds the item index cache.
+static const int ItemIndexCacheScanThreshold = 1024;
+
+// The cache is dropped once this many insertions and removals need to be applied on lookup.
+static const int MaximumItemIndexShifts = 64;
+
 int QQmlTreeModelToTableModel::itemIndex(const QModelIndex &index) const
 {
-    // This is basically a plagiarism of QTreeViewPrivate::viewIndex()
     if (!index.isValid() || index == m_rootIndex || m_items.isEmpty())
         return -1;
 
+    bool known = false;
+    const int cachedRow = cachedItemIndex(index, &known);
+    if (known) {
+        if (cachedRow != -1)
+            m_lastItemIndex = cachedRow;
+        return cachedRow;
+    }
+
+    int scanned = 0;
+    const int row = findItemIndex(index, &scanned);
+
+    // Scanning is cheap in the vicinity of the last item found. For huge trees, looking up
+    // rows further away makes it worth building the cache, so that later lookups, including
+    // the ones for items that aren't visible, don't need to scan anymore.
+    if (scanned > ItemIndexCacheScanThreshold)
+        rebuildItemIndexCache();
+
+    return row;
+}
+
+int QQmlTreeModelToTableModel::findItemIndex(const QModelIndex &index, int *scanned) const
+{
+    // This is basically a plagiarism of QTreeViewPrivate::viewIndex()
     const int totalCount = m_items.size();
 
     // We start nearest to the lastViewedItem
@@ -185,17 +214,21 @@ int QQmlTreeModelToTableModel::itemIndex(const QModelIndex &index) const
     for (int i = 0; i < localCount; ++i) {
         const TreeItem &item1 = m_items.at(m_lastItemIndex + i);
         if (item1.index == index) {
+            *scanned = 2 * i + 1;
             m_lastItemIndex = m_lastItemIndex + i;
             return m_lastItemIndex;
         }
         const TreeItem &item2 = m_items.at(m_lastItemIndex - i - 1);
         if (item2.index == index) {
+            *scanned = 2 * i + 2;
             m_lastItemIndex = m_lastItemIndex - i - 1;
             return m_lastItemIndex;
         }
     }
 
+    *scanned = 2 * qMax(localCount, 0);
     for (int j = qMax(0, m_lastItemIndex + localCount); j < totalCount; ++j) {
+        ++*scanned;
         const TreeItem &item = m_items.at(j);
         if (item.index == index) {
             m_lastItemIndex = j;
@@ -204,6 +237,7 @@ int QQmlTreeModelToTableModel::itemIndex(const QModelIndex &index) const
     }
 
     for (int j = qMin(totalCount, m_lastItemIndex - localCount) - 1; j >= 0; --j) {
+        ++*scanned;
         const TreeItem &item = m_items.at(j);
         if (item.index == index) {
             m_lastItemIndex = j;
@@ -215,6 +249,114 @@ int QQmlTreeModelToTableModel::itemIndex(const QModelIndex &index) const
     return -1;
 }
 
+/*!
+    \internal
+    Returns the row of \a index according to the item index cache. \a known is set if the
+    cache could tell. As the cache covers all items once built, an index it doesn't contain
+    is not visible.
+*/
+int QQmlTreeModelToTableModel::cachedItemIndex(const QModelIndex &index, bool *known) const
+{
+    *known = false;
+    if (!m_itemIndexCacheValid)
+        return -1;
+
+    const auto it = m_itemIndexCache.constFind(QPersistentModelIndex(index));
+    if (it == m_itemIndexCache.constEnd()) {
+        *known = true;
+        return -1;
+    }
+
+    int row = it->row;
+    for (qsizetype i = it->shiftCount, end = m_itemIndexShifts.size(); i < end; ++i) {
+        const RowShift &shift = m_itemIndexShifts.at(i);
+        if (row >= shift.row)
+            row += shift.count;
+    }
+
+    if (row < 0 || row >= m_items.size() || m_items.at(row).index != index) {
+        // Should not happen. Fall back to scanning.
+        qWarning() << "QQmlTreeModelToTableModel: stale item index cache for" << index;
+        const_cast<QQmlTreeModelToTableModel *>(this)->invalidateItemIndexCache();
+        return -1;
+    }
+
+    *known = true;
+    return row;
+}
+
+void QQmlTreeModelToTableModel::rebuildItemIndexCache() const
+{
+    m_itemIndexCache.clear();
+    m_itemIndexShifts.clear();
+    m_itemIndexCache.reserve(m_items.size());
+    for (int row = 0, end = m_items.size(); row < end; ++row)
+        m_itemIndexCache.insert(m_items.at(row).index, ItemIndexCacheEntry { row, 0 });
+    m_itemIndexCacheValid = true;
+}
+
+void QQmlTreeModelToTableModel::invalidateItemIndexCache()
+{
+    m_itemIndexCache.clear();
+    m_itemIndexShifts.clear();
+    m_itemIndexCacheValid = false;
+}
+
+/*!
+    \internal
+    Records \a count items that have been inserted at \a row in the item index cache.
+*/
+void QQmlTreeModelToTableModel::itemsInserted(int row, int count)
+{
+    if (!m_itemIndexCacheValid)
+        return;
+
+    if (m_itemIndexShifts.size() == MaximumItemIndexShifts) {
+        invalidateItemIndexCache();
+        return;
+    }
+
+    m_itemIndexShifts.append(RowShift { row, count });
+    const qsizetype shiftCount = m_itemIndexShifts.size();
+    for (int i = row, end = row + count; i < end; ++i)
+        m_itemIndexCache.insert(m_items.at(i).index, ItemIndexCacheEntry { i, shiftCount });
+}
+
+/*!
+    \internal
+    Records \a count items that are about to be removed at \a row in the item index cache.
+*/
+void QQmlTreeModelToTableModel::itemsAboutToBeRemoved(int row, int count)
+{
+    if (!m_itemIndexCacheValid)
+        return;
+
+    if (m_itemIndexShifts.size() == MaximumItemIndexShifts) {
+        invalidateItemIndexCache();
+        return;
+    }
+
+    for (int i = row, end = row + count; i < end; ++i)
+        m_itemIndexCache.remove(m_items.at(i).index);
+
+    // Rows removed are not in the cache anymore. Only the ones after them move.
+    m_itemIndexShifts.append(RowShift { row + count, -count });
+}
+
+/*!
+    \internal
+    Drops the item index cache when the rows of \a parent from \a row on have been moved by
+    an insertion or a removal in the model. The hash of a persistent index depends on its row,
+    so the cache can't find these siblings anymore once their rows have changed.
+*/
+void QQmlTreeModelToTableModel::modelSiblingsShifted(const QModelIndex &parent, int row)
+{
+    if (!m_itemIndexCacheValid || row >= m_model->rowCount(parent))
+        return;
+    if (parent == m_rootIndex || childrenVisible(parent))
+        invalidateItemIndexCache();
+}
+
 bool QQmlTreeModelToTableModel::isVisible(const QModelIndex &index)
 {
     return itemIndex(index) != -1;
@@ -244,15 +386,7 @@ QModelIndex QQmlTreeModelToTableModel::mapFromModel(const QModelIndex &index) co
     if (!index.isValid())
         return QModelIndex();
 
-    int row = -1;
-    for (int i = 0; i < m_items.size(); ++i) {
-        const QModelIndex proxyIndex = m_items[i].index;
-        if (proxyIndex.row() == index.row() && proxyIndex.parent() == index.parent()) {
-            row = i;
-            break;
-        }
-    }
-
+    const int row = itemIndex(index.siblingAtColumn(0));
     if (row == -1)
         return QModelIndex();
 
@@ -379,6 +513,7 @@ void QQmlTreeModelToTableModel::showModelChildItems(const TreeItem &parentItem,
         if (expanded)
             m_itemsToExpand.append(treeItem);
     }
+    itemsInserted(startIdx, insertCount);
 
     if (doInsertRows)
         endInsertRows();
@@ -602,6 +737,7 @@ void QQmlTreeModelToTableModel::removeVisibleRows(int startIndex, int endIndex,
 
     if (doRemoveRows)
         beginRemoveRows(QModelIndex(), startIndex, endIndex);
+    itemsAboutToBeRemoved(startIndex, endIndex - startIndex + 1);
     m_items.erase(m_items.begin() + startIndex, m_items.begin() + endIndex + 1);
     if (doRemoveRows) {
         endRemoveRows();
@@ -690,6 +826,7 @@ void QQmlTreeModelToTableModel::modelLayoutAboutToBeChanged(const QList<QPersist
         emit layoutAboutToBeChanged();
         m_modelLayoutChanged = true;
         m_items.clear();
+        invalidateItemIndexCache();
         return;
     }
 
@@ -767,6 +904,8 @@ void QQmlTreeModelToTableModel::modelRowsAboutToBeInserted(const QModelIndex & p
 
 void QQmlTreeModelToTableModel::modelRowsInserted(const QModelIndex & parent, int start, int end)
 {
+    modelSiblingsShifted(parent, end + 1);
+
     TreeItem item;
     int parentRow = itemIndex(parent);
     if (parentRow >= 0) {
@@ -818,8 +957,9 @@ void QQmlTreeModelToTableModel::modelRowsAboutToBeRemoved(const QModelIndex & pa
 
 void QQmlTreeModelToTableModel::modelRowsRemoved(const QModelIndex & parent, int start, int end)
 {
-    Q_UNUSED(start)
     Q_UNUSED(end)
+    modelSiblingsShifted(parent, start);
+
     int parentRow = itemIndex(parent);
     if (parentRow >= 0) {
         const QModelIndex& parentIndex = index(parentRow, m_column);
@@ -887,6 +1027,9 @@ void QQmlTreeModelToTableModel::modelRowsAboutToBeMoved(const QModelIndex & sour
         m_visibleRowsMoved = startIndex != destIndex &&
             beginMoveRows(QModelIndex(), startIndex, endIndex, QModelIndex(), destIndex);
 
+        // Moving rows shuffles everything in between. Rebuild the cache when needed.
+        invalidateItemIndexCache();
+
         const QList<TreeItem> &buffer = m_items.mid(startIndex, totalMovedCount);
         int bufferCopyOffset;
         if (destIndex > endIndex) {
@@ -943,6 +1086,9 @@ void QQmlTreeModelToTableModel::modelRowsAboutToBeMoved(const QModelIndex & sour
 
 void QQmlTreeModelToTableModel::modelRowsMoved(const QModelIndex & sourceParent, int sourceStart, int sourceEnd, const QModelIndex & destinationParent, int destinationRow)
 {
+    // The moved rows and the siblings after them on both ends have new rows now.
+    invalidateItemIndexCache();
+
     if (!childrenVisible(sourceParent)) {
         modelRowsInserted(destinationParent, destinationRow, destinationRow + sourceEnd - sourceStart);
     } else if (!childrenVisible(destinationParent)) {
@@ -1025,6 +1171,13 @@ bool QQmlTreeModelToTableModel::testConsistency(bool dumpOnFail) const
             qWarning() << "    set" << m_expandedItems.contains(item.index) << "item" << item.expanded;
             isConsistent = false;
         }
+        bool isCached = false;
+        const int cachedRow = cachedItemIndex(item.index, &isCached);
+        if (m_itemIndexCacheValid && cachedRow != i) {
+            qWarning() << "Item index cache inconsistency" << i << item.index;
+            qWarning() << "    cached row" << cachedRow;
+            isConsistent = false;
+        }
         if (!isConsistent) {
             if (dumpOnFail)
                 dump();
@@ -17,6 +17,7 @@
 
 #include "qtqmlmodelsglobal_p.h"
 
+#include <QtCore/qhash.h>
 #include <QtCore/qset.h>
 #include <QtCore/qpointer.h>
 #include <QtCore/qabstractitemmodel.h>
@@ -150,6 +151,24 @@ private:
         QQmlTreeModelToTableModel *m_parent;
     };
 
+    struct ItemIndexCacheEntry {
+        int row;
+        qsizetype shiftCount; // Size of m_itemIndexShifts when the row was recorded
+    };
+
+    struct RowShift {
+        int row;
+        int count; // Positive for inserted, negative for removed rows
+    };
+
+    int findItemIndex(const QModelIndex &index, int *scanned) const;
+    int cachedItemIndex(const QModelIndex &index, bool *known) const;
+    void rebuildItemIndexCache() const;
+    void invalidateItemIndexCache();
+    void itemsInserted(int row, int count);
+    void itemsAboutToBeRemoved(int row, int count);
+    void modelSiblingsShifted(const QModelIndex &parent, int row);
+
     void enableSignalAggregation();
     void disableSignalAggregation();
     bool isAggregatingSignals() const { return m_signalAggregatorStack > 0; }
@@ -164,6 +183,11 @@ private:
     QSet<QPersistentModelIndex> m_expandedItems;
     QList<TreeItem> m_itemsToExpand;
     mutable int m_lastItemIndex = 0;
+    // Once built, the cache maps all items to their rows at the time they were recorded.
+    // Rows inserted and removed since then are applied on lookup.
+    mutable QHash<QPersistentModelIndex, ItemIndexCacheEntry> m_itemIndexCache;
+    mutable QList<RowShift> m_itemIndexShifts;
+    mutable bool m_itemIndexCacheValid = false;
     bool m_visibleRowsMoved = false;
     bool m_modelLayoutChanged = false;
     int m_signalAggregatorStack = 0;
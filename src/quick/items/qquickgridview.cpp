@@ -498,10 +498,13 @@ bool QQuickGridViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
     bool changed = false;
 
     QQmlIncubator::IncubationMode incubationMode = doBuffer ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
+    // Items created for the cache buffer are not visible yet, so they should
+    // not hold up items that are incubated asynchronously elsewhere.
+    QQmlIncubatorPrivate::Priority incubationPriority = doBuffer ? QQmlIncubatorPrivate::LowPriority : QQmlIncubatorPrivate::NormalPriority;
 
     while (modelIndex < model->count() && rowPos <= fillTo + rowSize()*(columns - colNum)/(columns+1)) {
         qCDebug(lcItemViewDelegateLifecycle) << "refill: append item" << modelIndex << colPos << rowPos;
-        if (!(item = static_cast<FxGridItemSG*>(createItem(modelIndex, incubationMode))))
+        if (!(item = static_cast<FxGridItemSG*>(createItem(modelIndex, incubationMode, incubationPriority))))
             break;
         if (!transitioner || !transitioner->canTransition(QQuickItemViewTransitioner::PopulateTransition, true)) // pos will be set by layoutVisibleItems()
             item->setPosition(colPos, rowPos, true);
@@ -535,7 +538,7 @@ bool QQuickGridViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
     colPos = colNum * colSize();
     while (visibleIndex > 0 && rowPos + rowSize() - 1 >= fillFrom - rowSize()*(colNum+1)/(columns+1)){
         qCDebug(lcItemViewDelegateLifecycle) << "refill: prepend item" << visibleIndex-1 << "top pos" << rowPos << colPos;
-        if (!(item = static_cast<FxGridItemSG*>(createItem(visibleIndex-1, incubationMode))))
+        if (!(item = static_cast<FxGridItemSG*>(createItem(visibleIndex-1, incubationMode, incubationPriority))))
             break;
         --visibleIndex;
         if (!transitioner || !transitioner->canTransition(QQuickItemViewTransitioner::PopulateTransition, true)) // pos will be set by layoutVisibleItems()
@@ -2289,7 +2289,8 @@ void QQuickItemViewPrivate::viewItemTransitionFinished(QQuickItemViewTransitiona
   When the item becomes available, refill() will be called and the item
   will be returned on the next call to createItem().
 */
-FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::IncubationMode incubationMode)
+FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::IncubationMode incubationMode,
+                                              QQmlIncubatorPrivate::Priority incubationPriority)
 {
     Q_Q(QQuickItemView);
 
@@ -2308,7 +2309,11 @@ FxViewItem *QQuickItemViewPrivate::createItem(int modelIndex, QQmlIncubator::Inc
 
     // The model will run this same range check internally but produce a warning and return nullptr.
     // Since we handle this result graciously in our code, we preempt this warning by checking the range ourselves.
+    if (incubationPriority != QQmlIncubatorPrivate::NormalPriority)
+        model->setIncubationPriority(incubationPriority);
     QObject* object = modelIndex < model->count() ? model->object(modelIndex, incubationMode) : nullptr;
+    if (incubationPriority != QQmlIncubatorPrivate::NormalPriority)
+        model->setIncubationPriority(QQmlIncubatorPrivate::NormalPriority);
     QQuickItem *item = qmlobject_cast<QQuickItem*>(object);
 
     if (!item) {
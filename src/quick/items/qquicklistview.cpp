@@ -747,12 +747,15 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
     }
 
     QQmlIncubator::IncubationMode incubationMode = doBuffer ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested;
+    // Items created for the cache buffer are not visible yet, so they should
+    // not hold up items that are incubated asynchronously elsewhere.
+    QQmlIncubatorPrivate::Priority incubationPriority = doBuffer ? QQmlIncubatorPrivate::LowPriority : QQmlIncubatorPrivate::NormalPriority;
 
     bool changed = false;
     FxListItemSG *item = nullptr;
     qreal pos = itemEnd;
     while (modelIndex < model->count() && pos <= fillTo) {
-        if (!(item = static_cast<FxListItemSG*>(createItem(modelIndex, incubationMode))))
+        if (!(item = static_cast<FxListItemSG*>(createItem(modelIndex, incubationMode, incubationPriority))))
             break;
         qCDebug(lcItemViewDelegateLifecycle) << "refill: append item" << modelIndex << "pos" << pos << "buffer" << doBuffer << "item" << (QObject *)(item->item);
         if (!transitioner || !transitioner->canTransition(QQuickItemViewTransitioner::PopulateTransition, true)) // pos will be set by layoutVisibleItems()
@@ -769,7 +772,7 @@ bool QQuickListViewPrivate::addVisibleItems(qreal fillFrom, qreal fillTo, qreal
         return changed;
 
     while (visibleIndex > 0 && visibleIndex <= model->count() && visiblePos > fillFrom) {
-        if (!(item = static_cast<FxListItemSG*>(createItem(visibleIndex-1, incubationMode))))
+        if (!(item = static_cast<FxListItemSG*>(createItem(visibleIndex-1, incubationMode, incubationPriority))))
             break;
         qCDebug(lcItemViewDelegateLifecycle) << "refill: prepend item" << visibleIndex-1 << "current top pos" << visiblePos << "buffer" << doBuffer << "item" << (QObject *)(item->item);
         --visibleIndex;
@@ -2179,6 +2182,12 @@ QQuickItemViewAttached *QQuickListViewPrivate::getAttachedObject(const QObject *
     \note While an item is in the pool, it might still be alive and respond
     to connected signals and bindings.
 
+    Since pooled items stay alive, you can limit how many items the reuse pool
+    keeps by setting the \c QML_DELEGATE_POOL_LIMIT environment variable to the
+    maximum number of items. When the pool is full, an item that is flicked out
+    is destroyed instead, and the \l ListView::pooled signal is not emitted for it.
+    The limit is unset by default.
+
     The following example shows a delegate that animates a spinning rectangle. When
     it is pooled, the animation is temporarily paused:
 
@@ -658,6 +658,22 @@ void QQuickLoaderPrivate::setInitialState(QObject *obj)
     d->initializeObjectWithInitialProperties(qmlContext, ipv, obj, incubatorPriv->requiredProperties());
 }
 
+/*!
+    \internal
+    Asynchronous loaders that are not visible, such as the ones for pages in the background,
+    yield to all other incubation.
+*/
+void QQuickLoaderPrivate::updateIncubatorPriority()
+{
+    Q_Q(QQuickLoader);
+    if (!incubator || !asynchronous)
+        return;
+
+    QQmlIncubatorPrivate::get(incubator)->setPriority(q->isVisible()
+                                                       ? QQmlIncubatorPrivate::NormalPriority
+                                                       : QQmlIncubatorPrivate::LowPriority);
+}
+
 void QQuickLoaderIncubator::statusChanged(Status status)
 {
     loader->incubatorStateChanged(status);
@@ -728,6 +744,7 @@ void QQuickLoaderPrivate::_q_sourceLoaded()
 
     delete incubator;
     incubator = new QQuickLoaderIncubator(this, asynchronous ? QQmlIncubator::Asynchronous : QQmlIncubator::AsynchronousIfNested);
+    updateIncubatorPriority();
 
     component->create(*incubator, itemContext);
 
@@ -795,7 +812,10 @@ void QQuickLoader::componentComplete()
 
 void QQuickLoader::itemChange(QQuickItem::ItemChange change, const QQuickItem::ItemChangeData &value)
 {
-    if (change == ItemSceneChange) {
+    Q_D(QQuickLoader);
+    if (change == ItemVisibleHasChanged) {
+        d->updateIncubatorPriority();
+    } else if (change == ItemSceneChange) {
         QQuickWindow *loadedWindow = qmlobject_cast<QQuickWindow *>(item());
         if (loadedWindow) {
             qCDebug(lcTransient) << loadedWindow << "is transient for" << value.window;
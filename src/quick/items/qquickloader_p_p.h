@@ -58,6 +58,7 @@ public:
     void load();
 
     void incubatorStateChanged(QQmlIncubator::Status status);
+    void updateIncubatorPriority();
     void setInitialState(QObject *o);
     void disposeInitialPropertyValues();
     QQuickLoader::Status computeStatus() const;
@@ -6,6 +6,8 @@
 
 #include <QtCore/qtimer.h>
 #include <QtCore/qdir.h>
+#include <QtCore/qelapsedtimer.h>
+#include <QtGui/qscreen.h>
 #include <QtQmlModels/private/qqmldelegatemodel_p.h>
 #include <QtQmlModels/private/qqmldelegatemodel_p_p.h>
 #include <QtQml/private/qqmlincubator_p.h>
@@ -90,6 +92,12 @@
     \note While an item is in the pool, it might still be alive and respond
     to connected signals and bindings.
 
+    Since pooled items stay alive, you can limit how many items the reuse pool
+    keeps by setting the \c QML_DELEGATE_POOL_LIMIT environment variable to the
+    maximum number of items. When the pool is full, an item that is flicked out
+    is destroyed instead, and the \l TableView::pooled signal is not emitted for it.
+    The limit is unset by default.
+
     The following example shows a delegate that animates a spinning rectangle. When
     it is pooled, the animation is temporarily paused:
 
@@ -1149,6 +1157,239 @@ bool QQuickTableViewPrivate::EdgeRange::containsIndex(Qt::Edge edge, int index)
     return index >= s && index <= e;
 }
 
+void QQuickTableViewPrivate::EdgeSizeIndex::reset(int count)
+{
+    m_count = qMax(0, count);
+    m_sizes.clear();
+    m_tree.clear();
+    m_treeDirty = false;
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::resize(int count)
+{
+    // Keep the sizes recorded for the rows (or columns) that are still in the table
+    count = qMax(0, count);
+    if (count == m_count)
+        return;
+
+    if (count > m_count) {
+        insert(m_count, count - m_count);
+        return;
+    }
+
+    remove(count, m_count - count);
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::insert(int index, int count)
+{
+    // Shift the recorded sizes to make room for new rows (or columns),
+    // which have not been measured yet.
+    index = qBound(0, index, m_count);
+    if (count <= 0)
+        return;
+
+    const bool append = index == m_count;
+    m_count += count;
+    if (m_sizes.isEmpty())
+        return;
+
+    m_sizes.insert(index, count, -1);
+    if (append && !m_treeDirty)
+        appendToTree(count);
+    else
+        m_treeDirty = true;
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::remove(int index, int count)
+{
+    index = qBound(0, index, m_count);
+    count = qMin(count, m_count - index);
+    if (count <= 0)
+        return;
+
+    const bool truncate = index + count == m_count;
+    m_count -= count;
+    if (m_sizes.isEmpty())
+        return;
+
+    m_sizes.remove(index, count);
+    if (m_sizes.isEmpty()) {
+        m_tree.clear();
+        m_treeDirty = false;
+        return;
+    }
+
+    // A node in the tree only covers the rows in front of it, so
+    // removing rows from the end leaves the remaining nodes intact.
+    if (truncate && !m_treeDirty)
+        m_tree.resize(m_count + 1);
+    else
+        m_treeDirty = true;
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::move(int from, int to, int count)
+{
+    // Move the recorded sizes of count rows (or columns) at from, so
+    // that the first of them ends up at to after the move.
+    if (m_sizes.isEmpty() || count <= 0 || from == to)
+        return;
+    if (from < 0 || to < 0 || from + count > m_count || to + count > m_count)
+        return;
+
+    const auto begin = m_sizes.begin();
+    if (from < to)
+        std::rotate(begin + from, begin + from + count, begin + to + count);
+    else
+        std::rotate(begin + to, begin + from, begin + from + count);
+    m_treeDirty = true;
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::appendToTree(int count)
+{
+    // Add nodes for count unmeasured rows (or columns) at the end of the table.
+    // Each new node covers a range that ends with itself, so its value is the sum
+    // of the nodes in front of it that cover the rest of that range. This takes
+    // O(log n) per node, instead of rebuilding the whole tree.
+    const int oldCount = m_count - count;
+    m_tree.resize(m_count + 1);
+    for (int i = oldCount + 1; i <= m_count; ++i) {
+        Node &node = m_tree[i];
+        node = Node();
+        for (int child = i - 1; child > i - (i & -i); child -= child & -child) {
+            node.size += m_tree[child].size;
+            node.measured += m_tree[child].measured;
+            node.visible += m_tree[child].visible;
+        }
+    }
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::rebuildTree() const
+{
+    // Build the tree from the recorded sizes in O(n), by adding every
+    // node to the next node in the tree that also covers it.
+    m_treeDirty = false;
+    m_tree.fill(Node(), m_count + 1);
+    for (int i = 0; i < m_count; ++i) {
+        const qreal size = m_sizes[i];
+        if (size < 0)
+            continue;
+        Node &node = m_tree[i + 1];
+        node.size += size;
+        node.measured += 1;
+        node.visible += size > 0 ? 1 : 0;
+    }
+
+    for (int i = 1; i <= m_count; ++i) {
+        const int parent = i + (i & -i);
+        if (parent > m_count)
+            continue;
+        m_tree[parent].size += m_tree[i].size;
+        m_tree[parent].measured += m_tree[i].measured;
+        m_tree[parent].visible += m_tree[i].visible;
+    }
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::setSize(int index, qreal size)
+{
+    if (index < 0 || index >= m_count)
+        return;
+
+    if (m_sizes.isEmpty()) {
+        m_sizes.fill(-1, m_count);
+        m_tree.resize(m_count + 1);
+    }
+
+    const qreal oldSize = m_sizes[index];
+    if (size < 0 && oldSize < 0)
+        return;
+    if (size >= 0 && oldSize >= 0 && qFuzzyCompare(1 + size, 1 + oldSize))
+        return;
+
+    qreal sizeDelta = 0;
+    int measuredDelta = 0;
+    int visibleDelta = 0;
+
+    if (oldSize >= 0) {
+        sizeDelta -= oldSize;
+        measuredDelta -= 1;
+        visibleDelta -= oldSize > 0 ? 1 : 0;
+    }
+
+    if (size >= 0) {
+        sizeDelta += size;
+        measuredDelta += 1;
+        visibleDelta += size > 0 ? 1 : 0;
+    }
+
+    m_sizes[index] = size < 0 ? -1 : size;
+    // A dirty tree picks up the new size when it is rebuilt
+    if (!m_treeDirty)
+        update(index, sizeDelta, measuredDelta, visibleDelta);
+}
+
+void QQuickTableViewPrivate::EdgeSizeIndex::update(int index, qreal sizeDelta, int measuredDelta, int visibleDelta)
+{
+    for (int i = index + 1; i <= m_count; i += i & -i) {
+        Node &node = m_tree[i];
+        node.size += sizeDelta;
+        node.measured += measuredDelta;
+        node.visible += visibleDelta;
+    }
+}
+
+qreal QQuickTableViewPrivate::EdgeSizeIndex::position(int index, qreal averageSize, qreal spacing) const
+{
+    // Return the position of the given row (or column), which is the
+    // accumulated size and spacing of all the rows in front of it. Hidden
+    // rows that have been measured don't occupy any space.
+    if (index <= 0)
+        return 0;
+
+    const int end = qMin(index, m_count);
+    qreal pos = (index - end) * (averageSize + spacing);
+
+    if (m_tree.isEmpty())
+        return pos + (end * (averageSize + spacing));
+
+    ensureTree();
+    for (int i = end; i > 0; i -= i & -i)
+        pos += extent(m_tree[i], i & -i, averageSize, spacing);
+
+    return pos;
+}
+
+int QQuickTableViewPrivate::EdgeSizeIndex::indexAt(qreal pos, qreal averageSize, qreal spacing) const
+{
+    // Return the row (or column) that covers the given position. The
+    // returned index is not bounded to the number of rows in the table.
+    if (pos <= 0)
+        return 0;
+
+    if (m_tree.isEmpty())
+        return int(pos / (averageSize + spacing));
+
+    ensureTree();
+    int step = 1;
+    while (step * 2 <= m_count)
+        step *= 2;
+
+    int index = 0;
+    qreal remaining = pos;
+
+    for (; step > 0; step /= 2) {
+        const int next = index + step;
+        if (next > m_count)
+            continue;
+        const qreal size = extent(m_tree[next], step, averageSize, spacing);
+        if (size <= remaining) {
+            index = next;
+            remaining -= size;
+        }
+    }
+
+    return index;
+}
+
 QQuickTableViewPrivate::QQuickTableViewPrivate()
     : QQuickFlickablePrivate()
 {
@@ -1587,6 +1828,41 @@ void QQuickTableViewPrivate::clearEdgeSizeCache()
         cachedNextVisibleEdgeIndex[edgeToArrayIndex(edge)].startIndex = kEdgeIndexNotSet;
 }
 
+void QQuickTableViewPrivate::resetEdgeSizeIndex(Qt::Orientations orientations)
+{
+    // Forget the recorded column widths and/or row heights, since they might
+    // no longer be valid. Explicit sizes are known up front, so we record
+    // them again right away. The rest will be recorded as they get laid out.
+    if (orientations & Qt::Horizontal) {
+        columnSizeIndex.reset(tableSize.width());
+        recordExplicitEdgeSizes(Qt::Horizontal, true);
+    }
+
+    if (orientations & Qt::Vertical) {
+        rowSizeIndex.reset(tableSize.height());
+        recordExplicitEdgeSizes(Qt::Vertical, true);
+    }
+}
+
+void QQuickTableViewPrivate::recordExplicitEdgeSizes(Qt::Orientation orientation, bool record)
+{
+    // Record (or forget) the explicit column widths or row heights in the
+    // size index. Explicit sizes belong to a column (or row) number rather
+    // than to the model data, so they stay put when the model inserts,
+    // removes or moves columns (or rows), while the measured sizes follow.
+    if (orientation == Qt::Horizontal) {
+        if (syncHorizontally || !columnWidthProvider.isUndefined())
+            return;
+        for (auto it = explicitColumnWidths.cbegin(); it != explicitColumnWidths.cend(); ++it)
+            columnSizeIndex.setSize(it.key(), record ? it.value() : -1);
+    } else {
+        if (syncVertically || !rowHeightProvider.isUndefined())
+            return;
+        for (auto it = explicitRowHeights.cbegin(); it != explicitRowHeights.cend(); ++it)
+            rowSizeIndex.setSize(it.key(), record ? it.value() : -1);
+    }
+}
+
 int QQuickTableViewPrivate::nextVisibleEdgeIndexAroundLoadedTable(Qt::Edge edge) const
 {
     // Find the next column (or row) around the loaded table that is
@@ -1717,10 +1993,8 @@ void QQuickTableViewPrivate::updateContentWidth()
     }
 
     const int nextColumn = nextVisibleEdgeIndexAroundLoadedTable(Qt::RightEdge);
-    const int columnsRemaining = nextColumn == kEdgeIndexAtEnd ? 0 : tableSize.width() - nextColumn;
-    const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
-    const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
-    const qreal estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+    const qreal estimatedRemainingWidth = nextColumn == kEdgeIndexAtEnd ? 0
+            : columnPosition(tableSize.width()) - columnPosition(nextColumn);
     const qreal estimatedWidth = loadedTableOuterRect.right() + estimatedRemainingWidth;
 
     QBoolBlocker fixupGuard(inUpdateContentSize, true);
@@ -1750,10 +2024,8 @@ void QQuickTableViewPrivate::updateContentHeight()
     }
 
     const int nextRow = nextVisibleEdgeIndexAroundLoadedTable(Qt::BottomEdge);
-    const int rowsRemaining = nextRow == kEdgeIndexAtEnd ? 0 : tableSize.height() - nextRow;
-    const qreal remainingRowHeights = rowsRemaining * averageEdgeSize.height();
-    const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
-    const qreal estimatedRemainingHeight = remainingRowHeights + remainingSpacing;
+    const qreal estimatedRemainingHeight = nextRow == kEdgeIndexAtEnd ? 0
+            : rowPosition(tableSize.height()) - rowPosition(nextRow);
     const qreal estimatedHeight = loadedTableOuterRect.bottom() + estimatedRemainingHeight;
 
     QBoolBlocker fixupGuard(inUpdateContentSize, true);
@@ -1809,10 +2081,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The table rect is at the origin, or outside, but we still have more
         // visible columns to the left. So we try to guesstimate how much space
         // the rest of the columns will occupy, and move the origin accordingly.
-        const int columnsRemaining = nextLeftColumn + 1;
-        const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
-        const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
-        const qreal estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+        const qreal estimatedRemainingWidth = columnPosition(nextLeftColumn + 1);
         origin.rx() = loadedTableOuterRect.left() - estimatedRemainingWidth;
         hData.markExtentsDirty();
     } else if (nextRightColumn == kEdgeIndexAtEnd) {
@@ -1837,10 +2106,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The right-most column is outside the end of the content view, and we
         // still have more visible columns in the model. This can happen if the application
         // has set a fixed content width.
-        const int columnsRemaining = tableSize.width() - nextRightColumn;
-        const qreal remainingColumnWidths = columnsRemaining * averageEdgeSize.width();
-        const qreal remainingSpacing = columnsRemaining * cellSpacing.width();
-        const qreal estimatedRemainingWidth = remainingColumnWidths + remainingSpacing;
+        const qreal estimatedRemainingWidth = columnPosition(tableSize.width()) - columnPosition(nextRightColumn);
         const qreal pixelsOutsideContentWidth = loadedTableOuterRect.right() - q->contentWidth();
         endExtent.rwidth() = pixelsOutsideContentWidth + estimatedRemainingWidth;
         hData.markExtentsDirty();
@@ -1872,10 +2138,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The table rect is at the origin, or outside, but we still have more
         // visible rows at the top. So we try to guesstimate how much space
         // the rest of the rows will occupy, and move the origin accordingly.
-        const int rowsRemaining = nextTopRow + 1;
-        const qreal remainingRowHeights = rowsRemaining * averageEdgeSize.height();
-        const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
-        const qreal estimatedRemainingHeight = remainingRowHeights + remainingSpacing;
+        const qreal estimatedRemainingHeight = rowPosition(nextTopRow + 1);
         origin.ry() = loadedTableOuterRect.top() - estimatedRemainingHeight;
         vData.markExtentsDirty();
     } else if (nextBottomRow == kEdgeIndexAtEnd) {
@@ -1900,10 +2163,7 @@ void QQuickTableViewPrivate::updateExtents()
         // The bottom-most row is outside the end of the content view, and we
         // still have more visible rows in the model. This can happen if the application
         // has set a fixed content height.
-        const int rowsRemaining = tableSize.height() - nextBottomRow;
-        const qreal remainingRowHeigts = rowsRemaining * averageEdgeSize.height();
-        const qreal remainingSpacing = rowsRemaining * cellSpacing.height();
-        const qreal estimatedRemainingHeight = remainingRowHeigts + remainingSpacing;
+        const qreal estimatedRemainingHeight = rowPosition(tableSize.height()) - rowPosition(nextBottomRow);
         const qreal pixelsOutsideContentHeight = loadedTableOuterRect.bottom() - q->contentHeight();
         endExtent.rheight() = pixelsOutsideContentHeight + estimatedRemainingHeight;
         vData.markExtentsDirty();
@@ -2087,8 +2347,6 @@ void QQuickTableViewPrivate::forceLayout(bool immediate)
 
 void QQuickTableViewPrivate::syncLoadedTableFromLoadRequest()
 {
-    Q_Q(QQuickTableView);
-
     if (loadRequest.edge() == Qt::Edge(0)) {
         // No edge means we're loading the top-left item
         loadedColumns.insert(loadRequest.column());
@@ -2098,24 +2356,12 @@ void QQuickTableViewPrivate::syncLoadedTableFromLoadRequest()
 
     switch (loadRequest.edge()) {
     case Qt::LeftEdge:
-        loadedColumns.insert(loadRequest.column());
-        if (rebuildState == RebuildState::Done)
-            emit q->leftColumnChanged();
-        break;
     case Qt::RightEdge:
         loadedColumns.insert(loadRequest.column());
-        if (rebuildState == RebuildState::Done)
-            emit q->rightColumnChanged();
         break;
     case Qt::TopEdge:
-        loadedRows.insert(loadRequest.row());
-        if (rebuildState == RebuildState::Done)
-            emit q->topRowChanged();
-        break;
     case Qt::BottomEdge:
         loadedRows.insert(loadRequest.row());
-        if (rebuildState == RebuildState::Done)
-            emit q->bottomRowChanged();
         break;
     }
 }
@@ -2333,6 +2579,101 @@ Qt::Edge QQuickTableViewPrivate::nextEdgeToUnload(const QRectF rect)
     return Qt::Edge(0);
 }
 
+QRectF QQuickTableViewPrivate::prefetchRect() const
+{
+    // While the user is flicking, we extend the viewport in the direction of the
+    // flick by the distance the content will move while we load the next row or
+    // column. The rows and columns inside that area (but outside the viewport) are
+    // then incubated asynchronously, so that they are ready once they move into view.
+    Q_Q(const QQuickTableView);
+
+    if (rebuildState != RebuildState::Done || !q->isMoving() || qFuzzyIsNull(averageCellLoadTime))
+        return viewportRect;
+
+    if (syncView || !syncChildren.isEmpty()) {
+        // Tables that are synced need to load the same rows and columns.
+        return viewportRect;
+    }
+
+    // Since loading is spread out over frames, we always count at least one frame.
+    const QQuickWindow *window = q->window();
+    const qreal refreshRate = window && window->screen() ? window->screen()->refreshRate() : 60.;
+    const qreal frameTime = 1000. / (refreshRate > 0 ? refreshRate : 60.);
+    const qreal columnLoadTime = (loadedRows.count() * averageCellLoadTime + frameTime) / 1000.;
+    const qreal rowLoadTime = (loadedColumns.count() * averageCellLoadTime + frameTime) / 1000.;
+    const qreal dx = qBound(-viewportRect.width(), q->horizontalVelocity() * columnLoadTime, viewportRect.width());
+    const qreal dy = qBound(-viewportRect.height(), q->verticalVelocity() * rowLoadTime, viewportRect.height());
+
+    QRectF rect = viewportRect;
+    if (dx > 0)
+        rect.setRight(rect.right() + dx);
+    else
+        rect.setLeft(rect.left() + dx);
+    if (dy > 0)
+        rect.setBottom(rect.bottom() + dy);
+    else
+        rect.setTop(rect.top() + dy);
+    return rect;
+}
+
+QMargins QQuickTableViewPrivate::calculateVisibleEdges() const
+{
+    // Rows and columns that are prefetched while flicking are loaded into the table
+    // before they are inside the viewport. Those should not be reported as visible
+    // until they move into view, so skip them as long as they are outside of it.
+    auto left = loadedColumns.begin();
+    for (int i = 0; i < prefetchedEdgeCount.left() && *left != rightColumn(); ++i, ++left) {
+        if (getEffectiveColumnX(*left) + getEffectiveColumnWidth(*left) > viewportRect.left())
+            break;
+    }
+    auto right = loadedColumns.rbegin();
+    for (int i = 0; i < prefetchedEdgeCount.right() && *right != *left; ++i, ++right) {
+        if (getEffectiveColumnX(*right) < viewportRect.right())
+            break;
+    }
+    auto top = loadedRows.begin();
+    for (int i = 0; i < prefetchedEdgeCount.top() && *top != bottomRow(); ++i, ++top) {
+        if (getEffectiveRowY(*top) + getEffectiveRowHeight(*top) > viewportRect.top())
+            break;
+    }
+    auto bottom = loadedRows.rbegin();
+    for (int i = 0; i < prefetchedEdgeCount.bottom() && *bottom != *top; ++i, ++bottom) {
+        if (getEffectiveRowY(*bottom) < viewportRect.bottom())
+            break;
+    }
+
+    return QMargins(*left, *top, *right, *bottom);
+}
+
+void QQuickTableViewPrivate::updateVisibleEdges()
+{
+    Q_Q(QQuickTableView);
+
+    const QMargins oldEdges = visibleEdges;
+    visibleEdges = loadedItems.isEmpty() ? QMargins(-1, -1, -1, -1) : calculateVisibleEdges();
+
+    if (visibleEdges.left() != oldEdges.left())
+        emit q->leftColumnChanged();
+    if (visibleEdges.right() != oldEdges.right())
+        emit q->rightColumnChanged();
+    if (visibleEdges.top() != oldEdges.top())
+        emit q->topRowChanged();
+    if (visibleEdges.bottom() != oldEdges.bottom())
+        emit q->bottomRowChanged();
+}
+
+void QQuickTableViewPrivate::updateAverageCellLoadTime(qint64 nsecsElapsed, int cellCount)
+{
+    if (cellCount <= 0)
+        return;
+
+    // Use a moving average, so that the prefetch distance follows the cost of
+    // the delegates currently in view (which can change with e.g a DelegateChooser).
+    const qreal cellLoadTime = nsecsElapsed / 1000000. / cellCount;
+    averageCellLoadTime = qFuzzyIsNull(averageCellLoadTime)
+            ? cellLoadTime : (averageCellLoadTime * 3 + cellLoadTime) / 4;
+}
+
 qreal QQuickTableViewPrivate::cellWidth(const QPoint& cell) const
 {
     // Using an items width directly is not an option, since we change
@@ -2377,6 +2718,18 @@ void QQuickTableViewPrivate::updateTableSize()
     const QSize prevTableSize = tableSize;
     tableSize = calculateTableSize();
 
+    // The size indices have normally been updated already when the model
+    // inserted or removed rows and columns. Otherwise we keep the sizes
+    // recorded for the rows and columns that are still in the table.
+    if (columnSizeIndex.count() != tableSize.width()) {
+        columnSizeIndex.resize(tableSize.width());
+        recordExplicitEdgeSizes(Qt::Horizontal, true);
+    }
+    if (rowSizeIndex.count() != tableSize.height()) {
+        rowSizeIndex.resize(tableSize.height());
+        recordExplicitEdgeSizes(Qt::Vertical, true);
+    }
+
     if (prevTableSize.width() != tableSize.width())
         emit q->columnsChanged();
     if (prevTableSize.height() != tableSize.height())
@@ -2402,8 +2755,11 @@ qreal QQuickTableViewPrivate::getColumnLayoutWidth(int column)
     // can lead us to be stuck in an infinite loop trying to load and
     // fill out the empty viewport space with empty columns.
     const qreal explicitColumnWidth = getColumnWidth(column);
-    if (explicitColumnWidth >= 0)
+    if (explicitColumnWidth >= 0) {
+        if (!syncHorizontally)
+            columnSizeIndex.setSize(column, explicitColumnWidth);
         return explicitColumnWidth;
+    }
 
     if (syncHorizontally) {
         if (syncView->d_func()->loadedColumns.contains(column))
@@ -2425,6 +2781,9 @@ qreal QQuickTableViewPrivate::getColumnLayoutWidth(int column)
         columnWidth = kDefaultColumnWidth;
     }
 
+    if (!syncHorizontally)
+        columnSizeIndex.setSize(column, columnWidth);
+
     return columnWidth;
 }
 
@@ -2464,8 +2823,11 @@ qreal QQuickTableViewPrivate::getRowLayoutHeight(int row)
     // can lead us to be stuck in an infinite loop trying to load and
     // fill out the empty viewport space with empty rows.
     const qreal explicitRowHeight = getRowHeight(row);
-    if (explicitRowHeight >= 0)
+    if (explicitRowHeight >= 0) {
+        if (!syncVertically)
+            rowSizeIndex.setSize(row, explicitRowHeight);
         return explicitRowHeight;
+    }
 
     if (syncVertically) {
         if (syncView->d_func()->loadedRows.contains(row))
@@ -2487,6 +2849,9 @@ qreal QQuickTableViewPrivate::getRowLayoutHeight(int row)
         rowHeight = kDefaultRowHeight;
     }
 
+    if (!syncVertically)
+        rowSizeIndex.setSize(row, rowHeight);
+
     return rowHeight;
 }
 
@@ -2872,6 +3237,7 @@ void QQuickTableViewPrivate::processLoadRequest()
         // instead as an incremental build after e.g a flick.
         updateExtents();
         drainReusePoolAfterLoadRequest();
+        updateVisibleEdges();
     }
 
     loadRequest.markAsDone();
@@ -2900,6 +3266,7 @@ void QQuickTableViewPrivate::processRebuildTable()
 
         edgesBeforeRebuild = loadedItems.isEmpty() ? QMargins()
             : QMargins(q->leftColumn(), q->topRow(), q->rightColumn(), q->bottomRow());
+        prefetchedEdgeCount = QMargins();
     }
 
     moveToNextRebuildState();
@@ -2965,14 +3332,8 @@ void QQuickTableViewPrivate::processRebuildTable()
     }
 
     if (rebuildState == RebuildState::Done) {
-        if (edgesBeforeRebuild.left() != q->leftColumn())
-            emit q->leftColumnChanged();
-        if (edgesBeforeRebuild.right() != q->rightColumn())
-            emit q->rightColumnChanged();
-        if (edgesBeforeRebuild.top() != q->topRow())
-            emit q->topRowChanged();
-        if (edgesBeforeRebuild.bottom() != q->bottomRow())
-            emit q->bottomRowChanged();
+        visibleEdges = edgesBeforeRebuild;
+        updateVisibleEdges();
 
         updateCurrentRowAndColumn();
 
@@ -3069,12 +3430,12 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
             }
         } else if (rebuildOptions & RebuildOption::CalculateNewTopLeftColumn) {
             // Guesstimate new top left
-            const int newColumn = int(viewportRect.x() / (averageEdgeSize.width() + cellSpacing.width()));
+            const int newColumn = columnSizeIndex.indexAt(viewportRect.x(), averageEdgeSize.width(), cellSpacing.width());
             topLeftCell.rx() = qBound(0, newColumn, tableSize.width() - 1);
-            topLeftPos.rx() = topLeftCell.x() * (averageEdgeSize.width() + cellSpacing.width());
+            topLeftPos.rx() = columnPosition(topLeftCell.x());
         } else if (rebuildOptions & RebuildOption::PositionViewAtColumn) {
             topLeftCell.rx() = qBound(0, positionViewAtColumnAfterRebuild, tableSize.width() - 1);
-            topLeftPos.rx() = qFloor(topLeftCell.x()) * (averageEdgeSize.width() + cellSpacing.width());
+            topLeftPos.rx() = columnPosition(topLeftCell.x());
         } else {
             // Keep the current top left, unless it's outside model
             topLeftCell.rx() = qBound(0, leftColumn(), tableSize.width() - 1);
@@ -3095,12 +3456,12 @@ void QQuickTableViewPrivate::calculateTopLeft(QPoint &topLeftCell, QPointF &topL
             }
         } else if (rebuildOptions & RebuildOption::CalculateNewTopLeftRow) {
             // Guesstimate new top left
-            const int newRow = int(viewportRect.y() / (averageEdgeSize.height() + cellSpacing.height()));
+            const int newRow = rowSizeIndex.indexAt(viewportRect.y(), averageEdgeSize.height(), cellSpacing.height());
             topLeftCell.ry() = qBound(0, newRow, tableSize.height() - 1);
-            topLeftPos.ry() = topLeftCell.y() * (averageEdgeSize.height() + cellSpacing.height());
+            topLeftPos.ry() = rowPosition(topLeftCell.y());
         } else if (rebuildOptions & RebuildOption::PositionViewAtRow) {
             topLeftCell.ry() = qBound(0, positionViewAtRowAfterRebuild, tableSize.height() - 1);
-            topLeftPos.ry() = qFloor(topLeftCell.y()) * (averageEdgeSize.height() + cellSpacing.height());
+            topLeftPos.ry() = rowPosition(topLeftCell.y());
         } else {
             topLeftCell.ry() = qBound(0, topRow(), tableSize.height() - 1);
             topLeftPos.ry() = loadedTableOuterRect.y();
@@ -3286,7 +3647,6 @@ void QQuickTableViewPrivate::cancelOvershootAfterLayout()
 
 void QQuickTableViewPrivate::unloadEdge(Qt::Edge edge)
 {
-    Q_Q(QQuickTableView);
     qCDebug(lcTableViewDelegateLifecycle) << edge;
 
     switch (edge) {
@@ -3295,36 +3655,40 @@ void QQuickTableViewPrivate::unloadEdge(Qt::Edge edge)
         for (int row : loadedRows)
             unloadItem(QPoint(column, row));
         loadedColumns.remove(column);
+        prefetchedEdgeCount.setLeft(qMax(0, prefetchedEdgeCount.left() - 1));
         syncLoadedTableRectFromLoadedTable();
         if (rebuildState == RebuildState::Done)
-            emit q->leftColumnChanged();
+            updateVisibleEdges();
         break; }
     case Qt::RightEdge: {
         const int column = rightColumn();
         for (int row : loadedRows)
             unloadItem(QPoint(column, row));
         loadedColumns.remove(column);
+        prefetchedEdgeCount.setRight(qMax(0, prefetchedEdgeCount.right() - 1));
         syncLoadedTableRectFromLoadedTable();
         if (rebuildState == RebuildState::Done)
-            emit q->rightColumnChanged();
+            updateVisibleEdges();
         break; }
     case Qt::TopEdge: {
         const int row = topRow();
         for (int col : loadedColumns)
             unloadItem(QPoint(col, row));
         loadedRows.remove(row);
+        prefetchedEdgeCount.setTop(qMax(0, prefetchedEdgeCount.top() - 1));
         syncLoadedTableRectFromLoadedTable();
         if (rebuildState == RebuildState::Done)
-            emit q->topRowChanged();
+            updateVisibleEdges();
         break; }
     case Qt::BottomEdge: {
         const int row = bottomRow();
         for (int col : loadedColumns)
             unloadItem(QPoint(col, row));
         loadedRows.remove(row);
+        prefetchedEdgeCount.setBottom(qMax(0, prefetchedEdgeCount.bottom() - 1));
         syncLoadedTableRectFromLoadedTable();
         if (rebuildState == RebuildState::Done)
-            emit q->bottomRowChanged();
+            updateVisibleEdges();
         break; }
     }
 
@@ -3338,8 +3702,15 @@ void QQuickTableViewPrivate::loadEdge(Qt::Edge edge, QQmlIncubator::IncubationMo
 
     const auto &visibleCells = edge & (Qt::LeftEdge | Qt::RightEdge)
             ? loadedRows.values() : loadedColumns.values();
+
+    QElapsedTimer timer;
+    timer.start();
     loadRequest.begin(edge, edgeIndex, visibleCells, incubationMode);
     processLoadRequest();
+
+    // Only edges that finished loading right away tell us what a cell costs
+    if (!loadRequest.isActive())
+        updateAverageCellLoadTime(timer.nsecsElapsed(), visibleCells.size());
 }
 
 void QQuickTableViewPrivate::loadAndUnloadVisibleEdges(QQmlIncubator::IncubationMode incubationMode)
@@ -3368,11 +3739,12 @@ void QQuickTableViewPrivate::loadAndUnloadVisibleEdges(QQmlIncubator::Incubation
     }
 
     bool tableModified;
+    const QRectF fillRect = prefetchRect();
 
     do {
         tableModified = false;
 
-        if (Qt::Edge edge = nextEdgeToUnload(viewportRect)) {
+        if (Qt::Edge edge = nextEdgeToUnload(fillRect)) {
             tableModified = true;
             unloadEdge(edge);
         }
@@ -3382,6 +3754,26 @@ void QQuickTableViewPrivate::loadAndUnloadVisibleEdges(QQmlIncubator::Incubation
             loadEdge(edge, incubationMode);
             if (loadRequest.isActive())
                 return;
+        } else if (Qt::Edge edge = nextEdgeToLoad(fillRect)) {
+            // The edge is not yet visible, but will soon be flicked into view
+            tableModified = true;
+            switch (edge) {
+            case Qt::LeftEdge:
+                prefetchedEdgeCount.setLeft(prefetchedEdgeCount.left() + 1);
+                break;
+            case Qt::RightEdge:
+                prefetchedEdgeCount.setRight(prefetchedEdgeCount.right() + 1);
+                break;
+            case Qt::TopEdge:
+                prefetchedEdgeCount.setTop(prefetchedEdgeCount.top() + 1);
+                break;
+            case Qt::BottomEdge:
+                prefetchedEdgeCount.setBottom(prefetchedEdgeCount.bottom() + 1);
+                break;
+            }
+            loadEdge(edge, QQmlIncubator::Asynchronous);
+            if (loadRequest.isActive())
+                return;
         }
     } while (tableModified);
 
@@ -3504,11 +3896,25 @@ bool QQuickTableViewPrivate::updateTable()
     Q_TABLEVIEW_ASSERT(!polishing, "recursive updatePolish() calls are not allowed!");
     QBoolBlocker polishGuard(polishing, true);
 
+    if (loadRequest.isActive()
+            && loadRequest.incubationMode() == QQmlIncubator::Asynchronous
+            && nextEdgeToLoad(viewportRect)) {
+        // We're prefetching an edge, but the viewport has moved so that the table no
+        // longer covers it. Since we load one edge at a time, complete the prefetch right
+        // away, so that we can continue loading the edges that are now visible.
+        qCDebug(lcTableViewDelegateLifecycle()) << "completing prefetched edge:" << loadRequest.toString();
+        loadRequest.setIncubationMode(QQmlIncubator::AsynchronousIfNested);
+        processLoadRequest();
+    }
+
     if (loadRequest.isActive()) {
         // We're currently loading items async to build a new edge in the table. We see the loading
         // as an atomic operation, which means that we don't continue doing anything else until all
         // items have been received and laid out. Note that updatePolish is then called once more
         // after the loadRequest has completed to handle anything that might have occurred in-between.
+        // Rows and columns that were prefetched earlier might still have moved into view.
+        if (rebuildState == RebuildState::Done)
+            updateVisibleEdges();
         return false;
     }
 
@@ -3528,6 +3934,7 @@ bool QQuickTableViewPrivate::updateTable()
         return !loadRequest.isActive();
 
     loadAndUnloadVisibleEdges();
+    updateVisibleEdges();
 
     return !loadRequest.isActive();
 }
@@ -3788,6 +4195,12 @@ void QQuickTableViewPrivate::syncRebuildOptions()
 
     if (rebuildOptions.testFlag(RebuildOption::PositionViewAtColumn))
         rebuildOptions.setFlag(RebuildOption::CalculateNewTopLeftColumn, false);
+
+    // A full rebuild means that the model or the delegate was replaced or reset, so the
+    // recorded sizes of the rows and columns are no longer valid. Rows and columns that
+    // are inserted, removed or moved have already been accounted for in the size indices.
+    if (rebuildOptions.testFlag(RebuildOption::All))
+        resetEdgeSizeIndex(Qt::Horizontal | Qt::Vertical);
 }
 
 void QQuickTableViewPrivate::syncDelegate()
@@ -3985,52 +4398,88 @@ void QQuickTableViewPrivate::disconnectFromModel()
 
 void QQuickTableViewPrivate::modelUpdated(const QQmlChangeSet &changeSet, bool reset)
 {
-    Q_UNUSED(changeSet);
-    Q_UNUSED(reset);
-
     Q_TABLEVIEW_ASSERT(!model->abstractItemModel(), "");
+
+    // Models that are not QAIMs are lists, where every item is a row
+    if (reset) {
+        resetEdgeSizeIndex(Qt::Vertical);
+    } else if (!changeSet.isEmpty()) {
+        recordExplicitEdgeSizes(Qt::Vertical, false);
+        for (const QQmlChangeSet::Change &r : changeSet.removes())
+            rowSizeIndex.remove(r.index, r.count);
+        for (const QQmlChangeSet::Change &i : changeSet.inserts())
+            rowSizeIndex.insert(i.index, i.count);
+        recordExplicitEdgeSizes(Qt::Vertical, true);
+    }
+
     scheduleRebuildTable(RebuildOption::ViewportOnly
                          | RebuildOption::CalculateNewContentWidth
                          | RebuildOption::CalculateNewContentHeight);
 }
 
-void QQuickTableViewPrivate::rowsMovedCallback(const QModelIndex &parent, int, int, const QModelIndex &, int )
+void QQuickTableViewPrivate::rowsMovedCallback(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int row)
 {
     if (parent != QModelIndex())
         return;
 
+    if (destination == parent) {
+        const int count = end - start + 1;
+        recordExplicitEdgeSizes(Qt::Vertical, false);
+        rowSizeIndex.move(start, row > start ? row - count : row, count);
+        recordExplicitEdgeSizes(Qt::Vertical, true);
+    }
+
     scheduleRebuildTable(RebuildOption::ViewportOnly);
 }
 
-void QQuickTableViewPrivate::columnsMovedCallback(const QModelIndex &parent, int, int, const QModelIndex &, int)
+void QQuickTableViewPrivate::columnsMovedCallback(const QModelIndex &parent, int start, int end, const QModelIndex &destination, int column)
 {
     if (parent != QModelIndex())
         return;
 
+    if (destination == parent) {
+        const int count = end - start + 1;
+        recordExplicitEdgeSizes(Qt::Horizontal, false);
+        columnSizeIndex.move(start, column > start ? column - count : column, count);
+        recordExplicitEdgeSizes(Qt::Horizontal, true);
+    }
+
     scheduleRebuildTable(RebuildOption::ViewportOnly);
 }
 
-void QQuickTableViewPrivate::rowsInsertedCallback(const QModelIndex &parent, int, int)
+void QQuickTableViewPrivate::rowsInsertedCallback(const QModelIndex &parent, int begin, int end)
 {
     if (parent != QModelIndex())
         return;
 
+    recordExplicitEdgeSizes(Qt::Vertical, false);
+    rowSizeIndex.insert(begin, end - begin + 1);
+    recordExplicitEdgeSizes(Qt::Vertical, true);
+
     scheduleRebuildTable(RebuildOption::ViewportOnly | RebuildOption::CalculateNewContentHeight);
 }
 
-void QQuickTableViewPrivate::rowsRemovedCallback(const QModelIndex &parent, int, int)
+void QQuickTableViewPrivate::rowsRemovedCallback(const QModelIndex &parent, int begin, int end)
 {
     if (parent != QModelIndex())
         return;
 
+    recordExplicitEdgeSizes(Qt::Vertical, false);
+    rowSizeIndex.remove(begin, end - begin + 1);
+    recordExplicitEdgeSizes(Qt::Vertical, true);
+
     scheduleRebuildTable(RebuildOption::ViewportOnly | RebuildOption::CalculateNewContentHeight);
 }
 
-void QQuickTableViewPrivate::columnsInsertedCallback(const QModelIndex &parent, int, int)
+void QQuickTableViewPrivate::columnsInsertedCallback(const QModelIndex &parent, int begin, int end)
 {
     if (parent != QModelIndex())
         return;
 
+    recordExplicitEdgeSizes(Qt::Horizontal, false);
+    columnSizeIndex.insert(begin, end - begin + 1);
+    recordExplicitEdgeSizes(Qt::Horizontal, true);
+
     // Adding a column (or row) can result in the table going from being
     // e.g completely inside the viewport to go outside. And in the latter
     // case, the user needs to be able to scroll the viewport, also if
@@ -4039,11 +4488,15 @@ void QQuickTableViewPrivate::columnsInsertedCallback(const QModelIndex &parent,
     scheduleRebuildTable(RebuildOption::ViewportOnly | RebuildOption::CalculateNewContentWidth);
 }
 
-void QQuickTableViewPrivate::columnsRemovedCallback(const QModelIndex &parent, int, int)
+void QQuickTableViewPrivate::columnsRemovedCallback(const QModelIndex &parent, int begin, int end)
 {
     if (parent != QModelIndex())
         return;
 
+    recordExplicitEdgeSizes(Qt::Horizontal, false);
+    columnSizeIndex.remove(begin, end - begin + 1);
+    recordExplicitEdgeSizes(Qt::Horizontal, true);
+
     scheduleRebuildTable(RebuildOption::ViewportOnly | RebuildOption::CalculateNewContentWidth);
 }
 
@@ -4052,6 +4505,8 @@ void QQuickTableViewPrivate::layoutChangedCallback(const QList<QPersistentModelI
     Q_UNUSED(parents);
     Q_UNUSED(hint);
 
+    // We don't know where the rows and columns went
+    resetEdgeSizeIndex(Qt::Horizontal | Qt::Vertical);
     scheduleRebuildTable(RebuildOption::ViewportOnly);
 }
 
@@ -4282,6 +4737,9 @@ void QQuickTableViewPrivate::init()
     positionYAnimation.setProperty(QStringLiteral("contentY"));
     positionYAnimation.setEasing(QEasingCurve::OutQuart);
 
+    // Unload the rows and columns that we prefetched while the view was moving
+    QObject::connect(q, &QQuickFlickable::movementEnded, q, [q] { q->polish(); });
+
     auto tapHandler = new QQuickTapHandler(q->contentItem());
 
     QObject::connect(tapHandler, &QQuickTapHandler::pressedChanged, [this, q, tapHandler] {
@@ -4721,25 +5179,25 @@ void QQuickTableView::setPointerNavigationEnabled(bool enabled)
 int QQuickTableView::leftColumn() const
 {
     Q_D(const QQuickTableView);
-    return d->loadedItems.isEmpty() ? -1 : d_func()->leftColumn();
+    return d->loadedItems.isEmpty() ? -1 : d->calculateVisibleEdges().left();
 }
 
 int QQuickTableView::rightColumn() const
 {
     Q_D(const QQuickTableView);
-    return d->loadedItems.isEmpty() ? -1 : d_func()->rightColumn();
+    return d->loadedItems.isEmpty() ? -1 : d->calculateVisibleEdges().right();
 }
 
 int QQuickTableView::topRow() const
 {
     Q_D(const QQuickTableView);
-    return d->loadedItems.isEmpty() ? -1 : d_func()->topRow();
+    return d->loadedItems.isEmpty() ? -1 : d->calculateVisibleEdges().top();
 }
 
 int QQuickTableView::bottomRow() const
 {
     Q_D(const QQuickTableView);
-    return d->loadedItems.isEmpty() ? -1 : d_func()->bottomRow();
+    return d->loadedItems.isEmpty() ? -1 : d->calculateVisibleEdges().bottom();
 }
 
 int QQuickTableView::currentRow() const
@@ -5075,6 +5533,9 @@ void QQuickTableView::setColumnWidth(int column, qreal size)
     else
         d->explicitColumnWidths.insert(column, size);
 
+    if (d->columnWidthProvider.isUndefined())
+        d->columnSizeIndex.setSize(column, size);
+
     if (d->loadedItems.isEmpty())
         return;
 
@@ -5096,6 +5557,7 @@ void QQuickTableView::clearColumnWidths()
         return;
 
     d->explicitColumnWidths.clear();
+    d->resetEdgeSizeIndex(Qt::Horizontal);
     d->forceLayout(false);
 }
 
@@ -5133,6 +5595,9 @@ void QQuickTableView::setRowHeight(int row, qreal size)
     else
         d->explicitRowHeights.insert(row, size);
 
+    if (d->rowHeightProvider.isUndefined())
+        d->rowSizeIndex.setSize(row, size);
+
     if (d->loadedItems.isEmpty())
         return;
 
@@ -5154,6 +5619,7 @@ void QQuickTableView::clearRowHeights()
         return;
 
     d->explicitRowHeights.clear();
+    d->resetEdgeSizeIndex(Qt::Vertical);
     d->forceLayout(false);
 }
 
@@ -5207,7 +5673,12 @@ int QQuickTableView::columnAtIndex(const QModelIndex &index) const
 
 void QQuickTableView::forceLayout()
 {
-    d_func()->forceLayout(true);
+    Q_D(QQuickTableView);
+    // The application tells us that sizes might have changed, so
+    // the sizes we have recorded for rows and columns outside the
+    // viewport can no longer be trusted.
+    d->resetEdgeSizeIndex(Qt::Horizontal | Qt::Vertical);
+    d->forceLayout(true);
 }
 
 QQuickTableViewAttached *QQuickTableView::qmlAttachedProperties(QObject *obj)
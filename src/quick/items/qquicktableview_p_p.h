@@ -94,6 +94,7 @@ public:
         inline int row() const { return cellAt(0).y(); }
         inline int column() const { return cellAt(0).x(); }
         inline QQmlIncubator::IncubationMode incubationMode() const { return m_mode; }
+        inline void setIncubationMode(QQmlIncubator::IncubationMode mode) { m_mode = mode; }
 
         inline QPointF startPosition() const { return m_startPos; }
 
@@ -145,6 +146,54 @@ public:
         qreal size;
     };
 
+    class EdgeSizeIndex {
+        // EdgeSizeIndex records the sizes of the rows (or columns) that have been
+        // laid out, or that have an explicit size, in a Fenwick tree. This lets us
+        // map between a row and its position in the content view in O(log n), using
+        // the recorded sizes where we have them, and the average size elsewhere.
+    public:
+        int count() const { return m_count; }
+        void reset(int count);
+        void resize(int count);
+        void insert(int index, int count);
+        void remove(int index, int count);
+        void move(int from, int to, int count);
+        void setSize(int index, qreal size);
+        qreal position(int index, qreal averageSize, qreal spacing) const;
+        int indexAt(qreal pos, qreal averageSize, qreal spacing) const;
+
+    private:
+        struct Node {
+            qreal size = 0;
+            int measured = 0;
+            int visible = 0;
+        };
+
+        inline qreal extent(const Node &node, int length, qreal averageSize, qreal spacing) const
+        {
+            return node.size + (node.visible * spacing)
+                    + ((length - node.measured) * (averageSize + spacing));
+        }
+
+        void update(int index, qreal sizeDelta, int measuredDelta, int visibleDelta);
+        void appendToTree(int count);
+        void rebuildTree() const;
+        inline void ensureTree() const
+        {
+            if (m_treeDirty)
+                rebuildTree();
+        }
+
+        int m_count = 0;
+        // Allocated lazily, once the first size is recorded. A negative
+        // size means that the row or column has not been measured yet.
+        QVector<qreal> m_sizes;
+        // Rebuilt lazily from m_sizes on the next query after rows or
+        // columns have been inserted, removed or moved inside the table.
+        mutable QVector<Node> m_tree;
+        mutable bool m_treeDirty = false;
+    };
+
     enum class RebuildState {
         Begin = 0,
         LoadInitalTable,
@@ -265,6 +314,10 @@ public:
 
     QSizeF averageEdgeSize;
 
+    // The average time, in milliseconds, it takes to load a cell. This is used to
+    // decide how far ahead of a flick we should start loading rows and columns.
+    qreal averageCellLoadTime = 0;
+
     QPointer<QQuickTableView> assignedSyncView;
     QPointer<QQuickTableView> syncView;
     QList<QPointer<QQuickTableView> > syncChildren;
@@ -293,6 +346,8 @@ public:
     QRectF selectionEndCellRect;
 
     QMargins edgesBeforeRebuild;
+    QMargins visibleEdges;
+    QMargins prefetchedEdgeCount;
 
     int currentRow = -1;
     int currentColumn = -1;
@@ -300,6 +355,9 @@ public:
     QHash<int, qreal> explicitColumnWidths;
     QHash<int, qreal> explicitRowHeights;
 
+    EdgeSizeIndex columnSizeIndex;
+    EdgeSizeIndex rowSizeIndex;
+
 #ifdef QT_DEBUG
     QString forcedIncubationMode = qEnvironmentVariable("QT_TABLEVIEW_INCUBATION_MODE");
 #endif
@@ -330,6 +388,8 @@ public:
     qreal getEffectiveRowHeight(int row) const;
     qreal getEffectiveColumnX(int column) const;
     qreal getEffectiveColumnWidth(int column) const;
+    qreal columnPosition(int column) const { return columnSizeIndex.position(column, averageEdgeSize.width(), cellSpacing.width()); }
+    qreal rowPosition(int row) const { return rowSizeIndex.position(row, averageEdgeSize.height(), cellSpacing.height()); }
     qreal getAlignmentContentX(int column, Qt::Alignment alignment, const qreal offset, const QRectF &subRect);
     qreal getAlignmentContentY(int row, Qt::Alignment alignment, const qreal offset, const QRectF &subRect);
 
@@ -337,6 +397,8 @@ public:
     int bottomRow() const { return *loadedRows.crbegin(); }
     int leftColumn() const { return *loadedColumns.cbegin(); }
     int rightColumn() const { return *loadedColumns.crbegin(); }
+    QMargins calculateVisibleEdges() const;
+    void updateVisibleEdges();
 
     QQuickTableView *rootSyncView() const;
 
@@ -367,11 +429,15 @@ public:
     inline bool atTableEnd(Qt::Edge edge, int startIndex) const { return nextVisibleEdgeIndex(edge, startIndex) == kEdgeIndexAtEnd; }
     inline int edgeToArrayIndex(Qt::Edge edge) const;
     void clearEdgeSizeCache();
+    void resetEdgeSizeIndex(Qt::Orientations orientations);
+    void recordExplicitEdgeSizes(Qt::Orientation orientation, bool record);
 
     bool canLoadTableEdge(Qt::Edge tableEdge, const QRectF fillRect) const;
     bool canUnloadTableEdge(Qt::Edge tableEdge, const QRectF fillRect) const;
     Qt::Edge nextEdgeToLoad(const QRectF rect);
     Qt::Edge nextEdgeToUnload(const QRectF rect);
+    QRectF prefetchRect() const;
+    void updateAverageCellLoadTime(qint64 nsecsElapsed, int cellCount);
 
     qreal cellWidth(const QPoint &cell) const;
     qreal cellHeight(const QPoint &cell) const;
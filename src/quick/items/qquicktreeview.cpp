@@ -437,7 +437,7 @@ void QQuickTreeView::expandRecursively(int row, int depth)
         d->m_treeModelToTableModel.expandRecursively(startRow, depth);
         // Update the expanded state of the startRow. The descendant rows that gets
         // expanded will get the correct state set from initItem/itemReused instead.
-        for (int c = leftColumn(); c <= rightColumn(); ++c) {
+        for (int c = d->leftColumn(); c <= d->rightColumn(); ++c) {
             const QPoint treeNodeCell(c, startRow);
             if (const auto item = itemAtCell(treeNodeCell))
                 d->setRequiredProperty("expanded", true, d->modelIndexAtCell(treeNodeCell), item, false);
@@ -492,7 +492,7 @@ void QQuickTreeView::expandToIndex(const QModelIndex &index)
             d->m_treeModelToTableModel.expandRow(row);
 
             // Update the state of the already existing delegate item
-            for (int c = leftColumn(); c <= rightColumn(); ++c) {
+            for (int c = d->leftColumn(); c <= d->rightColumn(); ++c) {
                 const QPoint treeNodeCell(c, row);
                 if (const auto item = itemAtCell(treeNodeCell))
                     d->setRequiredProperty("expanded", true, d->modelIndexAtCell(treeNodeCell), item, false);
@@ -523,7 +523,7 @@ void QQuickTreeView::collapse(int row)
 
     d_func()->m_treeModelToTableModel.collapseRow(row);
 
-    for (int c = leftColumn(); c <= rightColumn(); ++c) {
+    for (int c = d->leftColumn(); c <= d->rightColumn(); ++c) {
         const QPoint treeNodeCell(c, row);
         if (const auto item = itemAtCell(treeNodeCell))
             d->setRequiredProperty("expanded", false, d->modelIndexAtCell(treeNodeCell), item, false);
@@ -545,7 +545,7 @@ void QQuickTreeView::collapseRecursively(int row)
         // even if the top row itself is already collapsed.
         d->m_treeModelToTableModel.collapseRecursively(startRow);
         // Update the expanded state of the (still visible) startRow
-        for (int c = leftColumn(); c <= rightColumn(); ++c) {
+        for (int c = d->leftColumn(); c <= d->rightColumn(); ++c) {
             const QPoint treeNodeCell(c, startRow);
             if (const auto item = itemAtCell(treeNodeCell))
                 d->setRequiredProperty("expanded", false, d->modelIndexAtCell(treeNodeCell), item, false);
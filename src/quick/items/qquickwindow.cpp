@@ -562,6 +562,7 @@ void QQuickWindowPrivate::syncSceneGraph()
     renderer->setClearMode(mode);
 
     renderer->setVisualizationMode(visualizationMode);
+    renderer->setFrameReportEnabled(frameReportEnabled);
 
     if (pendingFontUpdate) {
         context->invalidateGlyphCaches();
@@ -572,6 +573,39 @@ void QQuickWindowPrivate::syncSceneGraph()
     runAndClearJobs(&afterSynchronizingJobs);
 }
 
+/*!
+    \internal
+
+    Enables collecting a report of how the scene graph renderer batched and
+    uploaded the scene, for each frame it renders. Takes effect when the
+    scene graph is synchronized next time.
+
+    \sa frameReport()
+*/
+void QQuickWindowPrivate::setFrameReportEnabled(bool enabled)
+{
+    frameReportEnabled = enabled;
+    if (!enabled) {
+        QMutexLocker locker(&frameReportMutex);
+        lastFrameReport = QSGRendererFrameReport();
+    }
+}
+
+/*!
+    \internal
+
+    Returns the report of the last frame rendered for this window, or an
+    empty report if reporting is not enabled, or the renderer doesn't
+    provide one. This can be called from any thread.
+
+    \sa setFrameReportEnabled()
+*/
+QSGRendererFrameReport QQuickWindowPrivate::frameReport() const
+{
+    QMutexLocker locker(&frameReportMutex);
+    return lastFrameReport;
+}
+
 void QQuickWindowPrivate::emitBeforeRenderPassRecording(void *ud)
 {
     QQuickWindow *w = reinterpret_cast<QQuickWindow *>(ud);
@@ -664,6 +698,12 @@ void QQuickWindowPrivate::renderSceneGraph(const QSize &size, const QSize &surfa
 
     context->endNextFrame(renderer);
 
+    // Only enabled on the renderer while frameReportEnabled is set, see syncSceneGraph()
+    if (const QSGRendererFrameReport *report = renderer->frameReport()) {
+        QMutexLocker locker(&frameReportMutex);
+        lastFrameReport = *report;
+    }
+
     if (renderer && renderer->hasVisualizationModeWithContinuousUpdate()) {
         // For the overdraw visualizer. This update is not urgent so avoid a
         // direct update() call, this is only here to keep the overdraw
@@ -18,6 +18,7 @@
 #include <QtQuick/private/qquickdeliveryagent_p_p.h>
 #include <QtQuick/private/qquickevents_p_p.h>
 #include <QtQuick/private/qsgcontext_p.h>
+#include <QtQuick/private/qsgrenderer_p.h>
 #include <QtQuick/private/qquickpaletteproviderprivatebase_p.h>
 #include <QtQuick/private/qquickrendertarget_p.h>
 #include <QtQuick/private/qquickgraphicsdevice_p.h>
@@ -183,6 +184,13 @@ public:
     QSGRenderer *renderer;
     QByteArray visualizationMode; // Default renderer supports "clip", "overdraw", "changes", "batches" and blank.
 
+    // The report of the last frame rendered is copied here on the render thread.
+    bool frameReportEnabled = false;
+    mutable QMutex frameReportMutex;
+    QSGRendererFrameReport lastFrameReport;
+    void setFrameReportEnabled(bool enabled);
+    QSGRendererFrameReport frameReport() const;
+
     QSGRenderLoop *windowManager;
     QQuickRenderControl *renderControl;
     QScopedPointer<QQuickAnimatorController> animationController;
@@ -9,13 +9,25 @@
 #include "qsgsoftwarerenderablenode_p.h"
 
 #include <QtCore/QLoggingCategory>
+#include <QtCore/qmath.h>
+#if QT_CONFIG(thread)
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
+#endif
 #include <QtGui/QWindow>
+#include <QtGui/QImage>
+#include <QtGui/QPainter>
 #include <QtQuick/QSGSimpleRectNode>
 
 Q_LOGGING_CATEGORY(lc2DRender, "qt.scenegraph.softwarecontext.abstractrenderer")
 
 QT_BEGIN_NAMESPACE
 
+int qt_sg_envInt(const char *name, int defaultValue);
+
+// Bands painted in parallel are at least this many pixels high
+static const int MinimumBandHeight = 16;
+
 QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *context)
     : QSGRenderer(context)
     , m_background(new QSGSimpleRectNode)
@@ -24,6 +36,8 @@ QSGAbstractSoftwareRenderer::QSGAbstractSoftwareRenderer(QSGRenderContext *conte
     // Setup special background node
     auto backgroundRenderable = new QSGSoftwareRenderableNode(QSGSoftwareRenderableNode::SimpleRect, m_background);
     addNodeMapping(m_background, backgroundRenderable);
+
+    m_parallelRenderThreshold = qt_sg_envInt("QSG_SOFTWARE_RENDERER_PARALLEL_THRESHOLD", 65536);
 }
 
 QSGAbstractSoftwareRenderer::~QSGAbstractSoftwareRenderer()
@@ -93,6 +107,9 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     if (m_renderableNodes.isEmpty())
         return dirtyRegion;
 
+    if (renderNodesConcurrently(painter, &dirtyRegion))
+        return dirtyRegion;
+
     auto iterator = m_renderableNodes.begin();
     // First node is the background and needs to painted without blending
     auto backgroundNode = *iterator;
@@ -107,6 +124,104 @@ QRegion QSGAbstractSoftwareRenderer::renderNodes(QPainter *painter)
     return dirtyRegion;
 }
 
+/*
+ * Splits the area to repaint into horizontal bands, which are painted in
+ * parallel on the global thread pool, each band with its own QPainter. All
+ * of the painters paint into QImages sharing the pixels of the target image,
+ * and only write inside their own band. Every band paints the same nodes in
+ * the same order as renderNodes() would, clipped to the band, so the result
+ * is the same as painting sequentially.
+ *
+ * Returns false without painting anything when the nodes have to be painted
+ * sequentially, for instance because the target is not a QImage, the area
+ * to repaint is small, or a node can only be painted on the render thread.
+ */
+bool QSGAbstractSoftwareRenderer::renderNodesConcurrently(QPainter *painter, QRegion *dirtyRegion)
+{
+#if QT_CONFIG(thread)
+    if (m_parallelRenderThreshold <= 0)
+        return false;
+
+    // The bands must cover whole bytes in the target, and be aligned to
+    // whole device pixels.
+    QPaintDevice *device = painter->device();
+    if (device->devType() != QInternal::Image || painter->viewTransformEnabled())
+        return false;
+    QImage *target = static_cast<QImage *>(device);
+    const qreal dpr = target->devicePixelRatio();
+    if (target->depth() < 8 || target->format() == QImage::Format_Indexed8 || dpr != qFloor(dpr))
+        return false;
+
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    if (threadPool->maxThreadCount() < 1 || threadPool->contains(QThread::currentThread()))
+        return false;
+
+    QRect bounds;
+    for (QSGSoftwareRenderableNode *node : std::as_const(m_renderableNodes)) {
+        if (!node->isDirty())
+            continue;
+        if (node->type() != QSGSoftwareRenderableNode::RenderNode && node->isDirtyRegionEmpty())
+            continue;
+        if (!node->prepareConcurrentRender(dpr))
+            return false;
+        bounds |= node->dirtyRegion().boundingRect();
+    }
+
+    const qint64 area = qint64(bounds.width() * dpr) * qint64(bounds.height() * dpr);
+    const int bandCount = qMin(qMin(qint64(threadPool->maxThreadCount() + 1), area / m_parallelRenderThreshold),
+                               qint64(bounds.height() / MinimumBandHeight));
+    if (bandCount < 2)
+        return false;
+
+    uchar *bits = target->bits();
+    const QPainter::RenderHints renderHints = painter->renderHints();
+    auto renderBand = [this, target, bits, dpr, renderHints](const QRect &band) {
+        QImage image(bits, target->width(), target->height(), target->bytesPerLine(), target->format());
+        image.setDevicePixelRatio(dpr);
+        QPainter bandPainter(&image);
+        bandPainter.setRenderHints(renderHints);
+
+        auto iterator = m_renderableNodes.cbegin();
+        // First node is the background and needs to painted without blending
+        (*iterator)->renderNodePart(&bandPainter, band, /*force opaque painting*/ true);
+        for (++iterator; iterator != m_renderableNodes.cend(); ++iterator)
+            (*iterator)->renderNodePart(&bandPainter, band);
+    };
+
+    // The render thread paints the last band itself, as well as the ones no thread
+    // of the pool is available for right away, so that a pool kept busy by the
+    // application doesn't stall the frame.
+    QSemaphore semaphore;
+    int startedBands = 0;
+    int top = bounds.top();
+    for (int i = 0; i < bandCount; ++i) {
+        const int bottom = bounds.top() + int(qint64(bounds.height()) * (i + 1) / bandCount);
+        const QRect band(bounds.left(), top, bounds.width(), bottom - top);
+        const bool started = i < bandCount - 1
+                && threadPool->tryStart([&semaphore, &renderBand, band]() {
+                       renderBand(band);
+                       semaphore.release(1);
+                   });
+        if (started)
+            ++startedBands;
+        else
+            renderBand(band);
+        top = bottom;
+    }
+    semaphore.acquire(startedBands);
+
+    for (QSGSoftwareRenderableNode *node : std::as_const(m_renderableNodes))
+        *dirtyRegion += node->finishRenderParts();
+
+    qCDebug(lc2DRender) << "rendered" << bounds << "in" << bandCount << "bands";
+    return true;
+#else
+    Q_UNUSED(painter);
+    Q_UNUSED(dirtyRegion);
+    return false;
+#endif
+}
+
 void QSGAbstractSoftwareRenderer::buildRenderList()
 {
     // Clear the previous renderlist
@@ -133,10 +248,11 @@ QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
             node->subtractDirtyRegion(m_obscuredRegion);
         }
 
-        // Keep up with obscured regions
-        if (node->isOpaque()) {
-            m_obscuredRegion += node->boundingRectMin();
-        }
+        // Keep up with obscured regions. Nodes that are only partially
+        // opaque, like rounded rectangles, still hide what is below them.
+        const QRegion opaqueRegion = node->opaqueRegion();
+        if (!opaqueRegion.isEmpty())
+            m_obscuredRegion += opaqueRegion;
 
         if (node->isDirty()) {
             // Don't paint things outside of the rendering area
@@ -151,10 +267,13 @@ QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
             // Get the dirty region's to pass to the next nodes
             if (node->isOpaque()) {
                 // if isOpaque, subtract node's dirty rect from m_dirtyRegion
-                m_dirtyRegion -= node->boundingRectMin();
+                m_dirtyRegion -= opaqueRegion;
             } else {
-                // if isAlpha, add node's dirty rect to m_dirtyRegion
+                // if isAlpha, add node's dirty rect to m_dirtyRegion, except
+                // for the parts that are opaque nonetheless
                 m_dirtyRegion += node->dirtyRegion();
+                if (!opaqueRegion.isEmpty())
+                    m_dirtyRegion -= opaqueRegion;
             }
             // if previousDirtyRegion has content outside of boundingRect add to m_dirtyRegion
             QRegion prevDirty = node->previousDirtyRegion();
@@ -163,11 +282,8 @@ QRegion QSGAbstractSoftwareRenderer::optimizeRenderList()
         }
     }
 
-    if (m_obscuredRegion.contains(m_background->rect().toAlignedRect())) {
-        m_isOpaque = true;
-    } else {
-        m_isOpaque = false;
-    }
+    // QRegion::contains() only checks for an overlap
+    m_isOpaque = QRegion(m_background->rect().toAlignedRect()).subtracted(m_obscuredRegion).isEmpty();
 
     // Empty dirtyRegion (for second pass)
     m_dirtyRegion = QRegion();
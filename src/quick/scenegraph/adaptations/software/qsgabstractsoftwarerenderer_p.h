@@ -42,6 +42,7 @@ public:
 
 protected:
     QRegion renderNodes(QPainter *painter);
+    bool renderNodesConcurrently(QPainter *painter, QRegion *dirtyRegion);
     void buildRenderList();
     QRegion optimizeRenderList();
 
@@ -70,6 +71,7 @@ private:
     QRegion m_obscuredRegion;
     qreal m_devicePixelRatio = 1;
     bool m_isOpaque = false;
+    int m_parallelRenderThreshold;
 
     QSGSoftwareRenderableNodeUpdater *m_nodeUpdater;
 };
@@ -203,10 +203,7 @@ void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
 {
     //We can only check for a device pixel ratio change when we know what
     //paint device is being used.
-    if (!qFuzzyCompare(painter->device()->devicePixelRatio(), m_devicePixelRatio)) {
-        m_devicePixelRatio = painter->device()->devicePixelRatio();
-        generateCornerPixmap();
-    }
+    setDevicePixelRatio(painter->device()->devicePixelRatio());
 
     if (painter->transform().isRotating()) {
         //Rotated rectangles lose the benefits of direct rendering, and have poor rendering
@@ -241,6 +238,14 @@ void QSGSoftwareInternalRectangleNode::paint(QPainter *painter)
 
 }
 
+void QSGSoftwareInternalRectangleNode::setDevicePixelRatio(qreal ratio)
+{
+    if (!qFuzzyCompare(ratio, m_devicePixelRatio)) {
+        m_devicePixelRatio = ratio;
+        generateCornerPixmap();
+    }
+}
+
 bool QSGSoftwareInternalRectangleNode::isOpaque() const
 {
     if (m_radius > 0.0f)
@@ -259,6 +264,36 @@ bool QSGSoftwareInternalRectangleNode::isOpaque() const
     return true;
 }
 
+// The parts of the rectangle that paintRectangle() fills with opaque pixels,
+// for instance the inside of a rounded rectangle or of a translucent border.
+QVector<QRectF> QSGSoftwareInternalRectangleNode::opaqueRects() const
+{
+    if (m_stops.isEmpty()) {
+        if (m_color.alpha() < 255)
+            return {};
+    } else {
+        for (const QGradientStop &stop : std::as_const(m_stops)) {
+            if (stop.second.alpha() < 255)
+                return {};
+        }
+    }
+
+    const int radius = qFloor(qMin(qMin(m_rect.width(), m_rect.height()) * 0.5, m_radius));
+    const QRectF brushRect = QRectF(m_rect).marginsRemoved(QMarginsF(m_penWidth, m_penWidth, m_penWidth, m_penWidth));
+    const double innerRectRadius = qMax(0.0, radius - m_penWidth);
+
+    QVector<QRectF> rects;
+    const QRectF horizontal = brushRect.adjusted(0, innerRectRadius, 0, -innerRectRadius);
+    if (!horizontal.isEmpty())
+        rects.append(horizontal);
+    if (innerRectRadius > 0) {
+        const QRectF vertical = brushRect.adjusted(innerRectRadius, 0, -innerRectRadius, 0);
+        if (!vertical.isEmpty())
+            rects.append(vertical);
+    }
+    return rects;
+}
+
 QRectF QSGSoftwareInternalRectangleNode::rect() const
 {
     //TODO: double check that this is correct.
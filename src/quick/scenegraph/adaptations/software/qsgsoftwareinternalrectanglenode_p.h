@@ -41,8 +41,10 @@ public:
     void update() override;
 
     void paint(QPainter *);
+    void setDevicePixelRatio(qreal ratio);
 
     bool isOpaque() const;
+    QVector<QRectF> opaqueRects() const;
     QRectF rect() const;
 private:
     void paintRectangle(QPainter *painter, const QRect &rect);
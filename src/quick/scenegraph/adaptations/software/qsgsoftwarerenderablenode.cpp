@@ -192,6 +192,19 @@ void QSGSoftwareRenderableNode::update()
     if (m_opacity < 1.0f)
         m_isOpaque = false;
 
+    m_opaqueRegion = QRegion();
+    if (m_isOpaque) {
+        m_opaqueRegion = QRegion(m_boundingRectMin);
+    } else if (m_nodeType == QSGSoftwareRenderableNode::Rectangle && m_opacity >= 1.0f && !m_transform.isRotating()) {
+        // Rounded rectangles and rectangles with a translucent border are
+        // still opaque on the inside
+        const QVector<QRectF> opaqueRects = m_handle.rectangleNode->opaqueRects();
+        for (const QRectF &rect : opaqueRects)
+            m_opaqueRegion += toRectMin(m_transform.mapRect(rect)).intersected(m_boundingRectMin);
+    }
+    if (m_hasClipRegion && m_clipRegion.rectCount() > 1)
+        m_opaqueRegion &= m_clipRegion;
+
     m_dirtyRegion = QRegion(m_boundingRectMax);
 }
 
@@ -250,12 +263,79 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
         }
     }
 
+    paint(painter, m_dirtyRegion, forceOpaquePainting);
+
+    QRegion areaToBeFlushed = m_dirtyRegion;
+    m_previousDirtyRegion = QRegion(m_boundingRectMax);
+    m_isDirty = false;
+    m_dirtyRegion = QRegion();
+
+    return areaToBeFlushed;
+}
+
+bool QSGSoftwareRenderableNode::prepareConcurrentRender(qreal devicePixelRatio)
+{
+    switch (m_nodeType) {
+    case QSGSoftwareRenderableNode::SimpleRect:
+    case QSGSoftwareRenderableNode::SimpleTexture:
+    case QSGSoftwareRenderableNode::Image:
+    case QSGSoftwareRenderableNode::Painter:
+    case QSGSoftwareRenderableNode::NinePatch:
+    case QSGSoftwareRenderableNode::SimpleRectangle:
+#if QT_CONFIG(quick_sprite)
+    case QSGSoftwareRenderableNode::SpriteNode:
+#endif
+        return true;
+    case QSGSoftwareRenderableNode::Rectangle:
+        // Rotated rectangles are painted through a temporary pixmap. Otherwise
+        // only a change of device pixel ratio updates the node while painting.
+        if (m_transform.isRotating())
+            return false;
+        m_handle.rectangleNode->setDevicePixelRatio(devicePixelRatio);
+        return true;
+    default:
+        // Glyph nodes paint with QRawFont, which can only be used in the thread
+        // it was created in, image nodes may update their cached pixmap while
+        // painting, and render nodes paint with the render context's painter.
+        return false;
+    }
+}
+
+void QSGSoftwareRenderableNode::renderNodePart(QPainter *painter, const QRect &part, bool forceOpaquePainting) const
+{
+    Q_ASSERT(painter);
+    Q_ASSERT(m_nodeType != RenderNode);
+
+    if (!m_isDirty || qFuzzyIsNull(m_opacity))
+        return;
+    const QRegion region = m_dirtyRegion & part;
+    if (region.isEmpty())
+        return;
+
+    paint(painter, region, forceOpaquePainting);
+}
+
+QRegion QSGSoftwareRenderableNode::finishRenderParts()
+{
+    QRegion areaToBeFlushed;
+    if (m_isDirty && !qFuzzyIsNull(m_opacity) && !m_dirtyRegion.isEmpty()) {
+        areaToBeFlushed = m_dirtyRegion;
+        m_previousDirtyRegion = QRegion(m_boundingRectMax);
+    }
+    m_isDirty = false;
+    m_dirtyRegion = QRegion();
+
+    return areaToBeFlushed;
+}
+
+void QSGSoftwareRenderableNode::paint(QPainter *painter, const QRegion &region, bool forceOpaquePainting) const
+{
     painter->save();
     painter->setOpacity(m_opacity);
 
-    // Set clipRegion to m_dirtyRegion (in world coordinates, so must be done before the setTransform below)
+    // Set clipRegion to the dirty region (in world coordinates, so must be done before the setTransform below)
     // as m_dirtyRegion already accounts for clipRegion
-    painter->setClipRegion(m_dirtyRegion, Qt::ReplaceClip);
+    painter->setClipRegion(region, Qt::ReplaceClip);
     if (m_clipRegion.rectCount() > 1)
         painter->setClipRegion(m_clipRegion, Qt::IntersectClip);
 
@@ -310,13 +390,6 @@ QRegion QSGSoftwareRenderableNode::renderNode(QPainter *painter, bool forceOpaqu
     }
 
     painter->restore();
-
-    QRegion areaToBeFlushed = m_dirtyRegion;
-    m_previousDirtyRegion = QRegion(m_boundingRectMax);
-    m_isDirty = false;
-    m_dirtyRegion = QRegion();
-
-    return areaToBeFlushed;
 }
 
 bool QSGSoftwareRenderableNode::isDirtyRegionEmpty() const
@@ -62,8 +62,13 @@ public:
     void update();
 
     QRegion renderNode(QPainter *painter, bool forceOpaquePainting = false);
+    // Rendering the dirty region in parts, possibly from several threads at once
+    bool prepareConcurrentRender(qreal devicePixelRatio);
+    void renderNodePart(QPainter *painter, const QRect &part, bool forceOpaquePainting = false) const;
+    QRegion finishRenderParts();
     QRect boundingRectMin() const { return m_boundingRectMin; }
     QRect boundingRectMax() const { return m_boundingRectMax; }
+    QRegion opaqueRegion() const { return m_opaqueRegion; }
     NodeType type() const { return m_nodeType; }
     bool isOpaque() const { return m_isOpaque; }
     bool isDirty() const { return m_isDirty; }
@@ -87,6 +92,8 @@ public:
     QRegion dirtyRegion() const;
 
 private:
+    void paint(QPainter *painter, const QRegion &region, bool forceOpaquePainting) const;
+
     union RenderableNodeHandle {
         QSGNode *node;
         QSGSimpleRectNode *simpleRectNode;
@@ -118,6 +125,8 @@ private:
 
     QRect m_boundingRectMin;
     QRect m_boundingRectMax;
+    // The pixels the node covers completely, also when it is not opaque as a whole
+    QRegion m_opaqueRegion;
 };
 
 QT_END_NAMESPACE
@@ -7,8 +7,17 @@
 
 #include <qmath.h>
 
+#include <QtCore/QDataStream>
 #include <QtCore/QElapsedTimer>
+#include <QtCore/QFile>
+#include <QtCore/QLockFile>
+#include <QtCore/QSaveFile>
 #include <QtCore/QtNumeric>
+#if QT_CONFIG(thread)
+#include <QtCore/QSemaphore>
+#include <QtCore/QThreadPool>
+#endif
+#include <QtCore/private/qsimd_p.h>
 
 #include <QtGui/QGuiApplication>
 
@@ -84,6 +93,9 @@ const uint DYNAMIC_VERTEX_INDEX_BUFFER_THRESHOLD = 4;
 const int VERTEX_BUFFER_BINDING = 0;
 const int ZORDER_BUFFER_BINDING = VERTEX_BUFFER_BINDING + 1;
 
+// Number of elements to check for overlap before using the OverlapGrid
+const int OVERLAP_GRID_THRESHOLD = 32;
+
 template <class Int>
 inline Int aligned(Int v, Int byteAlign)
 {
@@ -198,6 +210,234 @@ QRhiGraphicsPipeline::Topology qsg_topology(int geomDrawMode)
     return topology;
 }
 
+// Pipeline traces are a list of PipelineTraceKeys with the bindings needed
+// for creating a layout-compatible srb. Shaders are stored once in a table
+// at the start of the file, since many pipelines share the same shaders.
+static const quint32 PIPELINE_TRACE_MAGIC = 0x51534750; // 'QSGP'
+static const quint32 PIPELINE_TRACE_VERSION = 1;
+
+static void qsg_writeGraphicsState(QDataStream &ds, const GraphicsState &s)
+{
+    ds << s.depthTest << s.depthWrite << int(s.depthFunc) << s.blending
+       << int(s.srcColor) << int(s.dstColor) << int(s.srcAlpha) << int(s.dstAlpha)
+       << int(s.colorWrite) << int(s.cullMode) << s.usesScissor << s.stencilTest
+       << s.sampleCount << int(s.drawMode) << s.lineWidth << int(s.polygonMode);
+}
+
+static void qsg_readGraphicsState(QDataStream &ds, GraphicsState *s)
+{
+    int depthFunc, srcColor, dstColor, srcAlpha, dstAlpha, colorWrite, cullMode, drawMode, polygonMode;
+    ds >> s->depthTest >> s->depthWrite >> depthFunc >> s->blending
+       >> srcColor >> dstColor >> srcAlpha >> dstAlpha
+       >> colorWrite >> cullMode >> s->usesScissor >> s->stencilTest
+       >> s->sampleCount >> drawMode >> s->lineWidth >> polygonMode;
+    s->depthFunc = QRhiGraphicsPipeline::CompareOp(depthFunc);
+    s->srcColor = QRhiGraphicsPipeline::BlendFactor(srcColor);
+    s->dstColor = QRhiGraphicsPipeline::BlendFactor(dstColor);
+    s->srcAlpha = QRhiGraphicsPipeline::BlendFactor(srcAlpha);
+    s->dstAlpha = QRhiGraphicsPipeline::BlendFactor(dstAlpha);
+    s->colorWrite = QRhiGraphicsPipeline::ColorMask(colorWrite);
+    s->cullMode = QRhiGraphicsPipeline::CullMode(cullMode);
+    s->drawMode = QSGGeometry::DrawingMode(drawMode);
+    s->polygonMode = QRhiGraphicsPipeline::PolygonMode(polygonMode);
+}
+
+static void qsg_writeVertexInputLayout(QDataStream &ds, const QRhiVertexInputLayout &layout)
+{
+    ds << quint32(layout.cendBindings() - layout.cbeginBindings());
+    for (auto it = layout.cbeginBindings(), end = layout.cendBindings(); it != end; ++it)
+        ds << it->stride() << int(it->classification()) << it->instanceStepRate();
+    ds << quint32(layout.cendAttributes() - layout.cbeginAttributes());
+    for (auto it = layout.cbeginAttributes(), end = layout.cendAttributes(); it != end; ++it)
+        ds << it->binding() << it->location() << int(it->format()) << it->offset();
+}
+
+static void qsg_readVertexInputLayout(QDataStream &ds, QRhiVertexInputLayout *layout)
+{
+    quint32 count = 0;
+    ds >> count;
+    QVarLengthArray<QRhiVertexInputBinding, 2> bindings;
+    for (quint32 i = 0; i < count && ds.status() == QDataStream::Ok; ++i) {
+        quint32 stride, stepRate;
+        int classification;
+        ds >> stride >> classification >> stepRate;
+        bindings.append(QRhiVertexInputBinding(stride, QRhiVertexInputBinding::Classification(classification), stepRate));
+    }
+    ds >> count;
+    QVarLengthArray<QRhiVertexInputAttribute, 8> attributes;
+    for (quint32 i = 0; i < count && ds.status() == QDataStream::Ok; ++i) {
+        int binding, location, format;
+        quint32 offset;
+        ds >> binding >> location >> format >> offset;
+        attributes.append(QRhiVertexInputAttribute(binding, location, QRhiVertexInputAttribute::Format(format), offset));
+    }
+    layout->setBindings(bindings.cbegin(), bindings.cend());
+    layout->setAttributes(attributes.cbegin(), attributes.cend());
+}
+
+static bool qsg_readPipelineTrace(const QString &fileName, PipelineTrace *trace, bool warnIfMissing = true)
+{
+    QFile f(fileName);
+    if (!f.open(QIODevice::ReadOnly)) {
+        if (warnIfMissing)
+            qWarning("Could not open pipeline trace file '%s'", qPrintable(fileName));
+        return false;
+    }
+
+    QDataStream ds(&f);
+    ds.setVersion(QDataStream::Qt_6_0);
+    quint32 magic = 0, version = 0;
+    ds >> magic >> version;
+    if (magic != PIPELINE_TRACE_MAGIC || version != PIPELINE_TRACE_VERSION) {
+        qWarning("'%s' is not a compatible pipeline trace file", qPrintable(fileName));
+        return false;
+    }
+
+    quint32 shaderCount = 0;
+    ds >> shaderCount;
+    QVector<QShader> shaders;
+    for (quint32 i = 0; i < shaderCount && ds.status() == QDataStream::Ok; ++i) {
+        QByteArray data;
+        ds >> data;
+        shaders.append(QShader::fromSerialized(data));
+    }
+
+    quint32 entryCount = 0;
+    ds >> entryCount;
+    PipelineTrace entries;
+    for (quint32 i = 0; i < entryCount && ds.status() == QDataStream::Ok; ++i) {
+        PipelineTraceKey key;
+        qsg_readGraphicsState(ds, &key.state);
+        bool valid = true;
+        quint32 stageCount = 0;
+        ds >> stageCount;
+        for (quint32 j = 0; j < stageCount && ds.status() == QDataStream::Ok; ++j) {
+            int type, variant;
+            quint32 shaderIndex;
+            ds >> type >> shaderIndex >> variant;
+            if (shaderIndex >= quint32(shaders.size()) || !shaders.at(shaderIndex).isValid()) {
+                valid = false;
+                continue;
+            }
+            key.shaderStages.append({ QRhiGraphicsShaderStage::Type(type), shaders.at(shaderIndex),
+                                      QShader::Variant(variant) });
+        }
+        qsg_readVertexInputLayout(ds, &key.inputLayout);
+        ds >> key.renderTargetDescription >> key.srbLayoutDescription;
+        quint32 bindingCount = 0;
+        ds >> bindingCount;
+        QVector<PipelineTraceBinding> bindings;
+        for (quint32 j = 0; j < bindingCount && ds.status() == QDataStream::Ok; ++j) {
+            int binding, stages, type, count;
+            ds >> binding >> stages >> type >> count;
+            bindings.append({ binding, QRhiShaderResourceBinding::StageFlags(stages),
+                              QRhiShaderResourceBinding::Type(type), count });
+        }
+        if (valid)
+            entries.insert(key, bindings);
+    }
+
+    if (ds.status() != QDataStream::Ok) {
+        qWarning("Failed to read pipeline trace file '%s'", qPrintable(fileName));
+        return false;
+    }
+
+    trace->insert(entries);
+    return true;
+}
+
+// Merges the trace into what is already in the file, so that recording
+// several runs of an application into the same file accumulates all the
+// pipelines they used.
+static void qsg_writePipelineTrace(const QString &fileName, const PipelineTrace &trace)
+{
+    // This runs on the render thread, so do not wait for long if another
+    // process holds on to the lock file.
+    QLockFile lock(fileName + QLatin1String(".lck"));
+    if (!lock.tryLock(1000)) {
+        qWarning("Could not lock pipeline trace file '%s', not saving the trace", qPrintable(fileName));
+        return;
+    }
+
+    PipelineTrace entries;
+    qsg_readPipelineTrace(fileName, &entries, false);
+    entries.insert(trace);
+
+    QVector<QShader> shaders;
+    QHash<QShader, quint32> shaderIndices;
+    for (auto it = entries.cbegin(), end = entries.cend(); it != end; ++it) {
+        for (const QRhiGraphicsShaderStage &stage : it.key().shaderStages) {
+            if (!shaderIndices.contains(stage.shader())) {
+                shaderIndices.insert(stage.shader(), quint32(shaders.size()));
+                shaders.append(stage.shader());
+            }
+        }
+    }
+
+#if QT_CONFIG(temporaryfile)
+    QSaveFile f(fileName);
+#else
+    QFile f(fileName);
+#endif
+    if (!f.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        const QString msg = f.errorString();
+        qWarning("Could not open pipeline trace output file '%s': %s",
+                 qPrintable(fileName), qPrintable(msg));
+        return;
+    }
+
+    QDataStream ds(&f);
+    ds.setVersion(QDataStream::Qt_6_0);
+    ds << PIPELINE_TRACE_MAGIC << PIPELINE_TRACE_VERSION;
+    ds << quint32(shaders.size());
+    for (const QShader &shader : std::as_const(shaders))
+        ds << shader.serialized();
+    ds << quint32(entries.size());
+    for (auto it = entries.cbegin(), end = entries.cend(); it != end; ++it) {
+        const PipelineTraceKey &key(it.key());
+        qsg_writeGraphicsState(ds, key.state);
+        ds << quint32(key.shaderStages.size());
+        for (const QRhiGraphicsShaderStage &stage : key.shaderStages)
+            ds << int(stage.type()) << shaderIndices.value(stage.shader()) << int(stage.shaderVariant());
+        qsg_writeVertexInputLayout(ds, key.inputLayout);
+        ds << key.renderTargetDescription << key.srbLayoutDescription;
+        ds << quint32(it.value().size());
+        for (const PipelineTraceBinding &b : it.value())
+            ds << b.binding << int(b.stages) << int(b.type) << b.count;
+    }
+
+    if (ds.status() != QDataStream::Ok
+#if QT_CONFIG(temporaryfile)
+            || !f.commit()
+#endif
+            )
+    {
+        const QString msg = f.errorString();
+        qWarning("Could not write pipeline trace: %s", qPrintable(msg));
+        return;
+    }
+
+    qCDebug(QSG_LOG_INFO, "Wrote %d pipelines to pipeline trace '%s'",
+            int(entries.size()), qPrintable(fileName));
+}
+
+ShaderManager::ShaderManager(QSGDefaultRenderContext *ctx)
+    : context(ctx)
+{
+    initPipelineTrace();
+}
+
+void ShaderManager::initPipelineTrace()
+{
+    pipelineTraceSaveFile = qEnvironmentVariable("QSG_RHI_PIPELINE_TRACE_SAVE");
+
+    const QString pipelineTraceLoadFile = qEnvironmentVariable("QSG_RHI_PIPELINE_TRACE_LOAD");
+    if (!pipelineTraceLoadFile.isEmpty() && qsg_readPipelineTrace(pipelineTraceLoadFile, &pipelineTraceWarmUp)) {
+        qCDebug(QSG_LOG_INFO, "Loaded %d pipelines to warm up from '%s'",
+                int(pipelineTraceWarmUp.size()), qPrintable(pipelineTraceLoadFile));
+    }
+}
+
 ShaderManager::Shader *ShaderManager::prepareMaterial(QSGMaterial *material,
                                                       const QSGGeometry *geometry,
                                                       QSGRendererInterface::RenderMode renderMode)
@@ -267,6 +507,21 @@ void ShaderManager::invalidated()
 
     qDeleteAll(srbPool);
     srbPool.clear();
+
+    if (isRecordingPipelines() && !pipelineTrace.isEmpty()) {
+        qsg_writePipelineTrace(pipelineTraceSaveFile, pipelineTrace);
+        pipelineTrace.clear();
+    }
+
+    // Warm up again if the rendercontext gets initialized with a new QRhi.
+    qDeleteAll(warmedUpPipelines);
+    warmedUpPipelines.clear();
+    pipelineTraceWarmUp.clear();
+    lastWarmUpRenderTargetDescription.clear();
+    pipelinesWarmedUp = 0;
+    warmedUpPipelinesTaken = 0;
+    pipelinesCreated = 0;
+    initPipelineTrace();
 }
 
 void ShaderManager::clearCachedRendererData()
@@ -712,6 +967,7 @@ bool Batch::geometryWasChanged(QSGGeometryNode *gn)
         e = e->nextInBatch;
     if (!e || e->node->geometry()->attributes() == gn->geometry()->attributes()) {
         needsUpload = true;
+        changes |= QSGRendererFrameReport::GeometryChanged;
         return true;
     } else {
         return false;
@@ -800,6 +1056,32 @@ bool Batch::isSafeToBatch() const {
     return true;
 }
 
+/*
+ * Returns true if the batch can stay merged after the transforms of the
+ * elements flagged with vertexTransformDirty have changed. The other
+ * elements were checked when the batch was last fully uploaded, so only
+ * the transformed ones need to pass the transform dependent checks of
+ * uploadBatch() again.
+ */
+bool Batch::isMergeableAfterTransformChange() const {
+    const bool needsTranslateOnly =
+            first->node->activeMaterial()->flags() & QSGMaterial::RequiresFullMatrixExceptTranslate;
+    Element *e = first;
+    while (e) {
+        if (e->vertexTransformDirty) {
+            if (needsTranslateOnly && !e->translateOnlyToRoot)
+                return false;
+            if (!is2DSafe(*e->node->matrix()))
+                return false;
+            e->ensureBoundsValid();
+            if (e->boundsOutsideFloatRange)
+                return false;
+        }
+        e = e->nextInBatch;
+    }
+    return true;
+}
+
 static int qsg_countNodesInBatch(const Batch *batch)
 {
     int sum = 0;
@@ -874,10 +1156,11 @@ Renderer::Renderer(QSGDefaultRenderContext *ctx, QSGRendererInterface::RenderMod
     m_batchNodeThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_NODE_THRESHOLD", 64);
     m_batchVertexThreshold = qt_sg_envInt("QSG_RENDERER_BATCH_VERTEX_THRESHOLD", 1024);
     m_srbPoolThreshold = qt_sg_envInt("QSG_RENDERER_SRB_POOL_THRESHOLD", 1024);
+    m_parallelUploadThreshold = qt_sg_envInt("QSG_RENDERER_PARALLEL_UPLOAD_THRESHOLD", 16384);
 
     if (Q_UNLIKELY(debug_build() || debug_render())) {
-        qDebug("Batch thresholds: nodes: %d vertices: %d Srb pool threshold: %d",
-               m_batchNodeThreshold, m_batchVertexThreshold, m_srbPoolThreshold);
+        qDebug("Batch thresholds: nodes: %d vertices: %d Srb pool threshold: %d parallel upload: %d",
+               m_batchNodeThreshold, m_batchVertexThreshold, m_srbPoolThreshold, m_parallelUploadThreshold);
     }
 }
 
@@ -1114,9 +1397,14 @@ void Renderer::nodeWasTransformed(Node *node, int *vertexCount)
             e->boundsComputed = false;
             if (e->batch) {
                 if (!e->batch->isOpaque) {
+                    m_rebuildChanges |= QSGRendererFrameReport::TransformChanged;
                     invalidateBatchAndOverlappingRenderOrders(e->batch);
                 } else if (e->batch->merged) {
-                    e->batch->needsUpload = true;
+                    // Only the vertices of this element need to be transformed
+                    // again, see uploadMergedTransforms().
+                    e->vertexTransformDirty = true;
+                    e->batch->needsTransformUpload = true;
+                    e->batch->changes |= QSGRendererFrameReport::TransformChanged;
                 }
             }
         }
@@ -1190,6 +1478,7 @@ void Renderer::nodeWasRemoved(Node *node)
             if (e->batch) {
                 e->batch->needsUpload = true;
                 e->batch->needsPurge = true;
+                e->batch->changes |= QSGRendererFrameReport::NodesChanged;
             }
 
         }
@@ -1214,8 +1503,10 @@ void Renderer::nodeWasRemoved(Node *node)
             if (m_renderNodeElements.isEmpty())
                 m_forceNoDepthBuffer = false;
 
-            if (e->batch != nullptr)
+            if (e->batch != nullptr) {
                 e->batch->needsPurge = true;
+                e->batch->changes |= QSGRendererFrameReport::NodesChanged;
+            }
         }
     }
 
@@ -1339,6 +1630,7 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
             Batch *b = e->batch;
             if (b) {
                 if (!e->batch->geometryWasChanged(gn) || !e->batch->isOpaque) {
+                    m_rebuildChanges |= QSGRendererFrameReport::GeometryChanged;
                     invalidateBatchAndOverlappingRenderOrders(e->batch);
                 } else {
                     b->needsUpload = true;
@@ -1353,10 +1645,13 @@ void Renderer::nodeChanged(QSGNode *node, QSGNode::DirtyState state)
             bool blended = hasMaterialWithBlending(static_cast<QSGGeometryNode *>(node));
             if (e->isMaterialBlended != blended) {
                 m_rebuild |= Renderer::FullRebuild;
+                m_rebuildChanges |= QSGRendererFrameReport::MaterialChanged;
                 e->isMaterialBlended = blended;
             } else if (e->batch) {
-                if (e->batch->isMaterialCompatible(e) == BatchBreaksOnCompare)
+                if (e->batch->isMaterialCompatible(e) == BatchBreaksOnCompare) {
+                    m_rebuildChanges |= QSGRendererFrameReport::MaterialChanged;
                     invalidateBatchAndOverlappingRenderOrders(e->batch);
+                }
             } else {
                 m_rebuild |= Renderer::BuildBatches;
             }
@@ -1611,8 +1906,10 @@ void Renderer::invalidateBatchAndOverlappingRenderOrders(Batch *batch)
         if (b->first) {
             int bf = b->first->order;
             int bl = b->lastOrderInBatch;
-            if (bl > first && bf < last)
+            if (bl > first && bf < last) {
                 b->invalidate();
+                m_rebuildChanges |= QSGRendererFrameReport::Overlap;
+            }
         }
     }
 
@@ -1682,15 +1979,113 @@ void Renderer::prepareOpaqueBatches()
     }
 }
 
-bool Renderer::checkOverlap(int first, int last, const Rect &bounds)
+static inline bool qsg_isOverlapCandidate(const Element *e)
 {
-    for (int i=first; i<=last; ++i) {
-        Element *e = m_alphaRenderList.at(i);
 #if defined(QSGBATCHRENDERER_INVALIDATE_WEDGED_NODES)
-        if (!e || e->batch)
+    return e && !e->batch;
 #else
-        if (!e)
+    return e;
 #endif
+}
+
+static inline bool qsg_isInvertedBounds(const Rect &r)
+{
+    // Also true for NaN. Bounds without width or height, such as the ones of
+    // horizontal or vertical lines, are not inverted: Rect::intersects() reports
+    // overlaps with them, so the grid must as well.
+    return !(r.tl.x <= r.br.x && r.tl.y <= r.br.y);
+}
+
+void OverlapGrid::reset(const Rect &extent, int elementCount)
+{
+    m_cells.clear();
+    m_usedCells.clear();
+    m_first = m_end = -1;
+    m_size = 0;
+    if (qsg_isInvertedBounds(extent))
+        return;
+
+    // Aim for a handful of elements per cell, but keep elements that cover
+    // most of the scene, such as backgrounds, cheap to insert.
+    m_size = qBound(1, int(qSqrt(qreal(elementCount))), 32);
+    m_extent = extent;
+    const float width = extent.br.x - extent.tl.x;
+    const float height = extent.br.y - extent.tl.y;
+    m_scaleX = width > 0 ? m_size / width : 0;
+    m_scaleY = height > 0 ? m_size / height : 0;
+    m_cells.resize(m_size * m_size);
+}
+
+void OverlapGrid::restart(int first)
+{
+    for (int cell : std::as_const(m_usedCells))
+        m_cells[cell].clear();
+    m_usedCells.clear();
+    m_first = m_end = first;
+}
+
+void OverlapGrid::insert(const Rect &bounds)
+{
+    if (qsg_isInvertedBounds(bounds))
+        return;
+    const int x1 = cellX(bounds.tl.x);
+    const int x2 = cellX(bounds.br.x);
+    const int y1 = cellY(bounds.tl.y);
+    const int y2 = cellY(bounds.br.y);
+    for (int y = y1; y <= y2; ++y) {
+        for (int x = x1; x <= x2; ++x) {
+            QList<Rect> &cell = m_cells[y * m_size + x];
+            if (cell.isEmpty())
+                m_usedCells.append(y * m_size + x);
+            cell.append(bounds);
+        }
+    }
+}
+
+bool OverlapGrid::intersects(const Rect &bounds) const
+{
+    if (qsg_isInvertedBounds(bounds))
+        return false;
+    const int x1 = cellX(bounds.tl.x);
+    const int x2 = cellX(bounds.br.x);
+    const int y1 = cellY(bounds.tl.y);
+    const int y2 = cellY(bounds.br.y);
+    for (int y = y1; y <= y2; ++y) {
+        for (int x = x1; x <= x2; ++x) {
+            for (const Rect &r : m_cells.at(y * m_size + x)) {
+                if (r.intersects(bounds))
+                    return true;
+            }
+        }
+    }
+    return false;
+}
+
+/*
+ * The elements in [first, last] are always the ones prepareAlphaBatches() has
+ * already stepped over while growing the batch starting at first - 1, so the
+ * grid only needs to take in the elements it has not seen yet. A new 'first'
+ * means a new batch is being grown and the grid starts over.
+ */
+bool Renderer::checkOverlap(int first, int last, const Rect &bounds)
+{
+    if (m_overlapGrid.isValid() && last - first >= OVERLAP_GRID_THRESHOLD) {
+        if (m_overlapGrid.first() != first)
+            m_overlapGrid.restart(first);
+        for (int i = m_overlapGrid.end(); i <= last; ++i) {
+            Element *e = m_alphaRenderList.at(i);
+            if (!qsg_isOverlapCandidate(e))
+                continue;
+            Q_ASSERT(e->boundsComputed);
+            m_overlapGrid.insert(e->bounds);
+        }
+        m_overlapGrid.setEnd(qMax(m_overlapGrid.end(), last + 1));
+        return m_overlapGrid.intersects(bounds);
+    }
+
+    for (int i=first; i<=last; ++i) {
+        Element *e = m_alphaRenderList.at(i);
+        if (!qsg_isOverlapCandidate(e))
             continue;
         Q_ASSERT(e->boundsComputed);
         if (e->bounds.intersects(bounds))
@@ -1712,14 +2107,21 @@ bool Renderer::checkOverlap(int first, int last, const Rect &bounds)
 
 void Renderer::prepareAlphaBatches()
 {
+    Rect extent;
+    extent.set(FLT_MAX, FLT_MAX, -FLT_MAX, -FLT_MAX);
     for (int i=0; i<m_alphaRenderList.size(); ++i) {
         Element *e = m_alphaRenderList.at(i);
         if (!e || e->isRenderNode)
             continue;
         Q_ASSERT(!e->removed);
         e->ensureBoundsValid();
+        if (!e->bounds.isOutsideFloatRange())
+            extent |= e->bounds;
     }
 
+    // Elements outside the extent are clamped into its border cells.
+    m_overlapGrid.reset(extent, m_alphaRenderList.size());
+
     for (int i=0; i<m_alphaRenderList.size(); ++i) {
         Element *ei = m_alphaRenderList.at(i);
         if (!ei || ei->batch)
@@ -1841,33 +2243,15 @@ static inline int qsg_fixIndexCount(int iCount, int drawMode)
  * iBase: The starting index for this element in the batch
  */
 
-void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount)
+void Renderer::uploadMergedElement(Element *e, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount)
 {
     if (Q_UNLIKELY(debug_upload())) qDebug() << "  - uploading element:" << e << e->node << (void *) *vertexData << (qintptr) (*zData - *vertexData) << (qintptr) (*indexData - *vertexData);
     QSGGeometry *g = e->node->geometry();
 
-    const QMatrix4x4 &localx = *e->node->matrix();
-    const float *localxdata = localx.constData();
-
+    // The vertex data itself is copied and transformed by uploadMergedVertices(),
+    // once the layout of the whole batch is known.
     const int vCount = g->vertexCount();
     const int vSize = g->sizeOfVertex();
-    memcpy(*vertexData, g->vertexData(), vSize * vCount);
-
-    // apply vertex transform..
-    char *vdata = *vertexData + vaOffset;
-    if (localx.flags() == QMatrix4x4::Translation) {
-        for (int i=0; i<vCount; ++i) {
-            Pt *p = (Pt *) vdata;
-            p->x += localxdata[12];
-            p->y += localxdata[13];
-            vdata += vSize;
-        }
-    } else if (localx.flags() > QMatrix4x4::Translation) {
-        for (int i=0; i<vCount; ++i) {
-            ((Pt *) vdata)->map(localx);
-            vdata += vSize;
-        }
-    }
 
     if (useDepthBuffer()) {
         float *vzorder = (float *) *zData;
@@ -1942,6 +2326,193 @@ void Renderer::uploadMergedElement(Element *e, int vaOffset, char **vertexData,
     *indexCount += iCount;
 }
 
+/*
+    Applies the 2D part of \a matrix to the \a count vertices in \a vdata, which
+    points to the x coordinate of the first vertex. Vertices are \a stride bytes
+    apart. The result is the same as calling Pt::map() on every vertex, but two
+    vertices are transformed at a time where SSE2 is available.
+ */
+static void qsg_transformVertices(char *vdata, int count, int stride, const QMatrix4x4 &matrix)
+{
+    const float *m = matrix.constData();
+    int i = 0;
+
+    if (matrix.flags() == QMatrix4x4::Identity)
+        return;
+
+    if (matrix.flags() == QMatrix4x4::Translation) {
+#if defined(__SSE2__)
+        const __m128 t = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+        for (; i + 1 < count; i += 2) {
+            __m128 v = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(vdata));
+            v = _mm_loadh_pi(v, reinterpret_cast<const __m64 *>(vdata + stride));
+            v = _mm_add_ps(v, t);
+            _mm_storel_pi(reinterpret_cast<__m64 *>(vdata), v);
+            _mm_storeh_pi(reinterpret_cast<__m64 *>(vdata + stride), v);
+            vdata += 2 * stride;
+        }
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+        const float32x2_t t = vld1_f32(m + 12);
+        for (; i < count; ++i) {
+            float *p = reinterpret_cast<float *>(vdata);
+            vst1_f32(p, vadd_f32(vld1_f32(p), t));
+            vdata += stride;
+        }
+#endif
+        for (; i < count; ++i) {
+            Pt *p = (Pt *) vdata;
+            p->x += m[12];
+            p->y += m[13];
+            vdata += stride;
+        }
+        return;
+    }
+
+#if defined(__SSE2__)
+    const __m128 m01 = _mm_setr_ps(m[0], m[1], m[0], m[1]);
+    const __m128 m45 = _mm_setr_ps(m[4], m[5], m[4], m[5]);
+    const __m128 t = _mm_setr_ps(m[12], m[13], m[12], m[13]);
+    for (; i + 1 < count; i += 2) {
+        __m128 v = _mm_loadl_pi(_mm_setzero_ps(), reinterpret_cast<const __m64 *>(vdata));
+        v = _mm_loadh_pi(v, reinterpret_cast<const __m64 *>(vdata + stride));
+        const __m128 xs = _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 0, 0));
+        const __m128 ys = _mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 1, 1));
+        v = _mm_add_ps(_mm_add_ps(_mm_mul_ps(xs, m01), _mm_mul_ps(ys, m45)), t);
+        _mm_storel_pi(reinterpret_cast<__m64 *>(vdata), v);
+        _mm_storeh_pi(reinterpret_cast<__m64 *>(vdata + stride), v);
+        vdata += 2 * stride;
+    }
+#elif defined(__ARM_NEON__) || defined(__ARM_NEON)
+    const float32x2_t m01 = vld1_f32(m);
+    const float32x2_t m45 = vld1_f32(m + 4);
+    const float32x2_t t = vld1_f32(m + 12);
+    for (; i < count; ++i) {
+        float *p = reinterpret_cast<float *>(vdata);
+        const float32x2_t v = vld1_f32(p);
+        const float32x2_t r = vadd_f32(vmul_n_f32(m01, vget_lane_f32(v, 0)),
+                                       vmul_n_f32(m45, vget_lane_f32(v, 1)));
+        vst1_f32(p, vadd_f32(r, t));
+        vdata += stride;
+    }
+#endif
+    for (; i < count; ++i) {
+        ((Pt *) vdata)->map(matrix);
+        vdata += stride;
+    }
+}
+
+/*
+    Copies the vertex data of the elements from \a first up to, but not including,
+    \a last into \a vertexData, and transforms it into the coordinate system of the
+    batch root. This only touches the vertex data of the given elements, so
+    separate ranges of the same batch can be uploaded from different threads.
+ */
+static void qsg_uploadMergedVertices(Element *first, Element *last, int vaOffset, char *vertexData)
+{
+    for (Element *e = first; e != last; e = e->nextInBatch) {
+        const QSGGeometry *g = e->node->geometry();
+        const int vCount = g->vertexCount();
+        const int vSize = g->sizeOfVertex();
+        memcpy(vertexData, g->vertexData(), vSize * vCount);
+        qsg_transformVertices(vertexData + vaOffset, vCount, vSize, *e->node->matrix());
+        vertexData += vCount * vSize;
+        e->vertexTransformDirty = false;
+    }
+}
+
+void Renderer::uploadMergedVertices(Batch *b)
+{
+#if QT_CONFIG(thread)
+    // Large batches are split into ranges of roughly the same number of vertices,
+    // which are uploaded in parallel. The render thread takes the last range itself,
+    // as well as the ones no thread of the pool is available for right away, so
+    // that a pool kept busy by the application doesn't stall the frame.
+    QThreadPool *threadPool = QThreadPool::globalInstance();
+    const int segmentCount = m_parallelUploadThreshold > 0
+            ? qMin(b->vertexCount / m_parallelUploadThreshold, threadPool->maxThreadCount() + 1)
+            : 1;
+
+    if (segmentCount > 1 && !threadPool->contains(QThread::currentThread())) {
+        QSemaphore semaphore;
+        const int vSize = b->first->node->geometry()->sizeOfVertex();
+        const int verticesPerSegment = b->vertexCount / segmentCount;
+        Element *segmentStart = b->first;
+        char *segmentData = b->vbo.data;
+        int segmentVertices = 0;
+        int segments = 0;
+        int startedSegments = 0;
+
+        for (Element *e = b->first; e; e = e->nextInBatch) {
+            if (segmentVertices >= verticesPerSegment && segments < segmentCount - 1) {
+                const bool started = threadPool->tryStart([&semaphore, segmentStart, e, b, segmentData]() {
+                    qsg_uploadMergedVertices(segmentStart, e, b->positionAttribute, segmentData);
+                    semaphore.release(1);
+                });
+                if (started)
+                    ++startedSegments;
+                else
+                    qsg_uploadMergedVertices(segmentStart, e, b->positionAttribute, segmentData);
+                ++segments;
+                segmentStart = e;
+                segmentData += segmentVertices * vSize;
+                segmentVertices = 0;
+            }
+            segmentVertices += e->node->geometry()->vertexCount();
+        }
+
+        qsg_uploadMergedVertices(segmentStart, nullptr, b->positionAttribute, segmentData);
+        semaphore.acquire(startedSegments);
+        return;
+    }
+#endif
+
+    qsg_uploadMergedVertices(b->first, nullptr, b->positionAttribute, b->vbo.data);
+}
+
+void Renderer::uploadMergedTransforms(Batch *b)
+{
+    // Only the transforms of some of the elements in this merged batch have
+    // changed since it was uploaded. The indices, z orders and the vertices of
+    // the other elements are still valid, so we only transform the vertices of
+    // the changed elements again, and write them into the existing vertex buffer.
+    // Consecutive changed elements are written with a single update.
+    if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "uploading transformed elements only...";
+
+    Buffer *buffer = &b->vbo;
+    const quint32 batchSize = b->vertexCount * b->first->node->geometry()->sizeOfVertex();
+    Element *rangeStart = nullptr;
+
+    for (Element *e = b->first; ; e = e->nextInBatch) {
+        const bool dirty = e && e->vertexTransformDirty;
+        if (dirty && !rangeStart) {
+            rangeStart = e;
+        } else if (!dirty && rangeStart) {
+            const quint32 offset = rangeStart->vertexOffset;
+            const quint32 size = (e ? e->vertexOffset : batchSize) - offset;
+            if (size > quint32(m_vertexUploadPool.size()))
+                m_vertexUploadPool.resize(size);
+            char *data = m_vertexUploadPool.data();
+            qsg_uploadMergedVertices(rangeStart, e, b->positionAttribute, data);
+
+            if (buffer->buf->type() != QRhiBuffer::Dynamic) {
+                m_resourceUpdates->uploadStaticBuffer(buffer->buf, offset, size, data);
+                buffer->nonDynamicChangeCount += 1;
+            } else {
+                m_resourceUpdates->updateDynamicBuffer(buffer->buf, offset, size, data);
+            }
+            b->uploadedBytes += size;
+            rangeStart = nullptr;
+        }
+        if (!e)
+            break;
+    }
+
+    b->needsTransformUpload = false;
+
+    if (Q_UNLIKELY(debug_render()))
+        b->uploadedThisFrame = true;
+}
+
 QMatrix4x4 qsg_matrixForRoot(Node *node)
 {
     if (node->type() == QSGNode::TransformNodeType)
@@ -1951,13 +2522,52 @@ QMatrix4x4 qsg_matrixForRoot(Node *node)
     return *c->matrix();
 }
 
+// Repeated shapes, whose position only comes from their transform, often
+// have identical geometry. An unmerged element whose geometry is the same as
+// the previous element's reuses its vertices and indices, so they are only
+// uploaded and bound once for the whole run.
+static bool qsg_isSameGeometry(const QSGGeometry *a, const QSGGeometry *b)
+{
+    if (a == b)
+        return true;
+
+    if (a->vertexCount() != b->vertexCount()
+            || a->indexCount() != b->indexCount()
+            || a->sizeOfVertex() != b->sizeOfVertex()
+            || a->sizeOfIndex() != b->sizeOfIndex()
+            || a->attributeCount() != b->attributeCount()
+            || a->drawingMode() != b->drawingMode())
+    {
+        return false;
+    }
+
+    return (a->attributes() == b->attributes()
+            || memcmp(a->attributes(), b->attributes(), a->attributeCount() * sizeof(QSGGeometry::Attribute)) == 0)
+            && memcmp(a->vertexData(), b->vertexData(), a->vertexCount() * a->sizeOfVertex()) == 0
+            && memcmp(a->indexData(), b->indexData(), a->indexCount() * a->sizeOfIndex()) == 0;
+}
+
 void Renderer::uploadBatch(Batch *b)
 {
+    // Only some transforms have changed in this batch. The vertex data kept around
+    // for the visualizer would get out of sync with a partial upload, so in that
+    // case we fall back to uploading everything. The same goes for transforms the
+    // batch cannot be merged with anymore, such as 3D ones.
+    if (!b->needsUpload && b->needsTransformUpload) {
+        if (b->vbo.buf && m_visualizer->mode() == Visualizer::VisualizeNothing
+                && b->isMergeableAfterTransformChange()) {
+            uploadMergedTransforms(b);
+            return;
+        }
+        b->needsUpload = true;
+    }
+
     // Early out if nothing has changed in this batch..
     if (!b->needsUpload) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "already uploaded...";
         return;
     }
+    b->needsTransformUpload = false;
 
     if (!b->first) {
         if (Q_UNLIKELY(debug_upload())) qDebug() << " Batch:" << b << "is invalid...";
@@ -1989,7 +2599,10 @@ void Renderer::uploadBatch(Batch *b)
     // Figure out how much memory we need...
     b->vertexCount = 0;
     b->indexCount = 0;
+    b->sharedGeometryCount = 0;
+    int unmergedVertexSize = 0;
     int unmergedIndexSize = 0;
+    const QSGGeometry *previousGeometry = nullptr;
     Element *e = b->first;
 
     while (e) {
@@ -2001,8 +2614,15 @@ void Renderer::uploadBatch(Batch *b)
                 iCount = eg->vertexCount();
             iCount = qsg_fixIndexCount(iCount, g->drawingMode());
         } else {
-            const int effectiveIndexSize = m_uint32IndexForRhi ? sizeof(quint32) : eg->sizeOfIndex();
-            unmergedIndexSize += iCount * effectiveIndexSize;
+            e->sharesGeometry = previousGeometry && qsg_isSameGeometry(previousGeometry, eg);
+            if (e->sharesGeometry) {
+                ++b->sharedGeometryCount;
+            } else {
+                const int effectiveIndexSize = m_uint32IndexForRhi ? sizeof(quint32) : eg->sizeOfIndex();
+                unmergedVertexSize += eg->vertexCount() * eg->sizeOfVertex();
+                unmergedIndexSize += iCount * effectiveIndexSize;
+            }
+            previousGeometry = eg;
         }
         b->indexCount += iCount;
         e = e->nextInBatch;
@@ -2025,13 +2645,15 @@ void Renderer::uploadBatch(Batch *b)
               primitive. These are unsigned shorts for merged and arbitrary for
               non-merged.
          */
-    int bufferSize =  b->vertexCount * g->sizeOfVertex();
+    int bufferSize = 0;
     int ibufferSize = 0;
     if (b->merged) {
+        bufferSize = b->vertexCount * g->sizeOfVertex();
         ibufferSize = b->indexCount * mergedIndexElemSize();
         if (useDepthBuffer())
             bufferSize += b->vertexCount * sizeof(float);
     } else {
+        bufferSize = unmergedVertexSize;
         ibufferSize = unmergedIndexSize;
     }
 
@@ -2080,7 +2702,8 @@ void Renderer::uploadBatch(Batch *b)
             void *iBasePtr = &iOffset16;
             if (m_uint32IndexForRhi)
                 iBasePtr = &iOffset32;
-            uploadMergedElement(e, b->positionAttribute, &vertexData, &zData, &indexData, iBasePtr, &indicesInSet);
+            e->vertexOffset = vertexData - b->vbo.data;
+            uploadMergedElement(e, &vertexData, &zData, &indexData, iBasePtr, &indicesInSet);
             e = e->nextInBatch;
         }
         b->drawSets.last().indexCount = indicesInSet;
@@ -2090,11 +2713,22 @@ void Renderer::uploadBatch(Batch *b)
             b->drawSets.last().indices += 1 * mergedIndexElemSize();
             b->drawSets.last().indexCount -= 2;
         }
+        uploadMergedVertices(b);
     } else {
         char *vboData = b->vbo.data;
         char *iboData = b->ibo.data;
+        Element *previous = nullptr;
         Element *e = b->first;
         while (e) {
+            if (e->sharesGeometry) {
+                e->vertexOffset = previous->vertexOffset;
+                e->indexOffset = previous->indexOffset;
+                previous = e;
+                e = e->nextInBatch;
+                continue;
+            }
+            e->vertexOffset = vboData - b->vbo.data;
+            e->indexOffset = iboData - b->ibo.data;
             QSGGeometry *g = e->node->geometry();
             int vbs = g->vertexCount() * g->sizeOfVertex();
             memcpy(vboData, g->vertexData(), vbs);
@@ -2117,14 +2751,16 @@ void Renderer::uploadBatch(Batch *b)
                 }
                 iboData += ibs;
             }
+            previous = e;
             e = e->nextInBatch;
         }
     }
 #ifndef QT_NO_DEBUG_OUTPUT
     if (Q_UNLIKELY(debug_upload())) {
         const char *vd = b->vbo.data;
-        qDebug() << "  -- Vertex Data, count:" << b->vertexCount << " - " << g->sizeOfVertex() << "bytes/vertex";
-        for (int i=0; i<b->vertexCount; ++i) {
+        const int uploadedVertexCount = b->merged ? b->vertexCount : unmergedVertexSize / g->sizeOfVertex();
+        qDebug() << "  -- Vertex Data, count:" << uploadedVertexCount << " - " << g->sizeOfVertex() << "bytes/vertex";
+        for (int i=0; i<uploadedVertexCount; ++i) {
             QDebug dump = qDebug().nospace();
             dump << "  --- " << i << ": ";
             int offset = 0;
@@ -2187,6 +2823,7 @@ void Renderer::uploadBatch(Batch *b)
 
     unmap(&b->vbo);
     unmap(&b->ibo, true);
+    b->uploadedBytes += b->vbo.size + b->ibo.size;
 
     if (Q_UNLIKELY(debug_upload())) qDebug() << "  --- vertex/index buffers unmapped, batch upload completed...";
 
@@ -2546,6 +3183,72 @@ static inline bool needsBlendConstant(QRhiGraphicsPipeline::BlendFactor f)
             || f == QRhiGraphicsPipeline::OneMinusConstantAlpha;
 }
 
+static QRhiGraphicsPipeline *qsg_createGraphicsPipeline(QRhi *rhi,
+                                                        const GraphicsState &gstate,
+                                                        const QVarLengthArray<QRhiGraphicsShaderStage, 2> &shaderStages,
+                                                        const QRhiVertexInputLayout &inputLayout,
+                                                        QRhiShaderResourceBindings *srb,
+                                                        QRhiRenderPassDescriptor *rpDesc)
+{
+    QRhiGraphicsPipeline *ps = rhi->newGraphicsPipeline();
+    ps->setShaderStages(shaderStages.cbegin(), shaderStages.cend());
+    ps->setVertexInputLayout(inputLayout);
+    ps->setShaderResourceBindings(srb);
+    ps->setRenderPassDescriptor(rpDesc);
+
+    QRhiGraphicsPipeline::Flags flags;
+    if (needsBlendConstant(gstate.srcColor) || needsBlendConstant(gstate.dstColor)
+            || needsBlendConstant(gstate.srcAlpha) || needsBlendConstant(gstate.dstAlpha))
+    {
+        flags |= QRhiGraphicsPipeline::UsesBlendConstants;
+    }
+    if (gstate.usesScissor)
+        flags |= QRhiGraphicsPipeline::UsesScissor;
+    if (gstate.stencilTest)
+        flags |= QRhiGraphicsPipeline::UsesStencilRef;
+
+    ps->setFlags(flags);
+    ps->setTopology(qsg_topology(gstate.drawMode));
+    ps->setCullMode(gstate.cullMode);
+    ps->setPolygonMode(gstate.polygonMode);
+
+    QRhiGraphicsPipeline::TargetBlend blend;
+    blend.colorWrite = gstate.colorWrite;
+    blend.enable = gstate.blending;
+    blend.srcColor = gstate.srcColor;
+    blend.dstColor = gstate.dstColor;
+    blend.srcAlpha = gstate.srcAlpha;
+    blend.dstAlpha = gstate.dstAlpha;
+    ps->setTargetBlends({ blend });
+
+    ps->setDepthTest(gstate.depthTest);
+    ps->setDepthWrite(gstate.depthWrite);
+    ps->setDepthOp(gstate.depthFunc);
+
+    if (gstate.stencilTest) {
+        ps->setStencilTest(true);
+        QRhiGraphicsPipeline::StencilOpState stencilOp;
+        stencilOp.compareOp = QRhiGraphicsPipeline::Equal;
+        stencilOp.failOp = QRhiGraphicsPipeline::Keep;
+        stencilOp.depthFailOp = QRhiGraphicsPipeline::Keep;
+        stencilOp.passOp = QRhiGraphicsPipeline::Keep;
+        ps->setStencilFront(stencilOp);
+        ps->setStencilBack(stencilOp);
+    }
+
+    ps->setSampleCount(gstate.sampleCount);
+
+    ps->setLineWidth(gstate.lineWidth);
+
+    if (!ps->create()) {
+        qWarning("Failed to build graphics pipeline state");
+        delete ps;
+        return nullptr;
+    }
+
+    return ps;
+}
+
 // With QRhi renderBatches() is split to two steps: prepare and render.
 //
 // Prepare goes through the batches and elements, and set up a graphics
@@ -2599,69 +3302,128 @@ bool Renderer::ensurePipelineState(Element *e, const ShaderManager::Shader *sms,
         return true;
     }
 
-    // Build a new one. This is potentially expensive.
-    QRhiGraphicsPipeline *ps = m_rhi->newGraphicsPipeline();
-    ps->setShaderStages(sms->programRhi.shaderStages.cbegin(), sms->programRhi.shaderStages.cend());
-    ps->setVertexInputLayout(sms->programRhi.inputLayout);
-    ps->setShaderResourceBindings(e->srb);
-    ps->setRenderPassDescriptor(renderTarget().rpDesc);
+    // Build a new one, unless one was created up front from a pipeline
+    // trace. This is potentially expensive.
+    QRhiGraphicsPipeline *ps = m_shaderManager->takeWarmedUpPipeline(k);
+    if (!ps) {
+        ps = qsg_createGraphicsPipeline(m_rhi, m_gstate, sms->programRhi.shaderStages,
+                                        sms->programRhi.inputLayout, e->srb, renderTarget().rpDesc);
+        if (!ps)
+            return false;
+        ++m_shaderManager->pipelinesCreated;
+    } else {
+        ++m_shaderManager->warmedUpPipelinesTaken;
+    }
 
-    QRhiGraphicsPipeline::Flags flags;
-    if (needsBlendConstant(m_gstate.srcColor) || needsBlendConstant(m_gstate.dstColor)
-            || needsBlendConstant(m_gstate.srcAlpha) || needsBlendConstant(m_gstate.dstAlpha))
-    {
-        flags |= QRhiGraphicsPipeline::UsesBlendConstants;
+    if (m_shaderManager->isRecordingPipelines())
+        m_shaderManager->recordPipeline(k, e->srb);
+
+    m_shaderManager->pipelineCache.insert(k, ps);
+    if (depthPostPass)
+        e->depthPostPassPs = ps;
+    else
+        e->ps = ps;
+    return true;
+}
+
+void ShaderManager::recordPipeline(const GraphicsPipelineStateKey &k, const QRhiShaderResourceBindings *srb)
+{
+    QVector<PipelineTraceBinding> bindings;
+    for (auto it = srb->cbeginBindings(), end = srb->cendBindings(); it != end; ++it) {
+        const QRhiShaderResourceBinding::Data *d = it->data();
+        // Materials only use plain uniform buffers and combined image samplers.
+        if (d->type == QRhiShaderResourceBinding::UniformBuffer && !d->u.ubuf.hasDynamicOffset)
+            bindings.append({ d->binding, d->stage, d->type, 1 });
+        else if (d->type == QRhiShaderResourceBinding::SampledTexture)
+            bindings.append({ d->binding, d->stage, d->type, d->u.stex.count });
+        else
+            return;
     }
-    if (m_gstate.usesScissor)
-        flags |= QRhiGraphicsPipeline::UsesScissor;
-    if (m_gstate.stencilTest)
-        flags |= QRhiGraphicsPipeline::UsesStencilRef;
+    pipelineTrace.insert(PipelineTraceKey::create(k), bindings);
+}
 
-    ps->setFlags(flags);
-    ps->setTopology(qsg_topology(m_gstate.drawMode));
-    ps->setCullMode(m_gstate.cullMode);
-    ps->setPolygonMode(m_gstate.polygonMode);
+// Creates the pipelines from the loaded trace that are compatible with the
+// render target, so that rendering the scene later on does not have to. The
+// srbs are only used for their layout, so they refer to placeholder resources.
+// A pipeline is reusable with any compatible srb and render target, the
+// renderer relies on that in ensurePipelineState() as well.
+void ShaderManager::warmUpPipelines(QRhi *rhi, QRhiRenderPassDescriptor *rpDesc)
+{
+    const QVector<quint32> rtDesc = rpDesc->serializedFormat();
+    if (rtDesc == lastWarmUpRenderTargetDescription)
+        return;
+    lastWarmUpRenderTargetDescription = rtDesc;
 
-    QRhiGraphicsPipeline::TargetBlend blend;
-    blend.colorWrite = m_gstate.colorWrite;
-    blend.enable = m_gstate.blending;
-    blend.srcColor = m_gstate.srcColor;
-    blend.dstColor = m_gstate.dstColor;
-    blend.srcAlpha = m_gstate.srcAlpha;
-    blend.dstAlpha = m_gstate.dstAlpha;
-    ps->setTargetBlends({ blend });
+    QElapsedTimer timer;
+    timer.start();
 
-    ps->setDepthTest(m_gstate.depthTest);
-    ps->setDepthWrite(m_gstate.depthWrite);
-    ps->setDepthOp(m_gstate.depthFunc);
+    QRhiBuffer *ubuf = nullptr;
+    QRhiTexture *texture = nullptr;
+    QRhiSampler *sampler = nullptr;
+    int created = 0;
 
-    if (m_gstate.stencilTest) {
-        ps->setStencilTest(true);
-        QRhiGraphicsPipeline::StencilOpState stencilOp;
-        stencilOp.compareOp = QRhiGraphicsPipeline::Equal;
-        stencilOp.failOp = QRhiGraphicsPipeline::Keep;
-        stencilOp.depthFailOp = QRhiGraphicsPipeline::Keep;
-        stencilOp.passOp = QRhiGraphicsPipeline::Keep;
-        ps->setStencilFront(stencilOp);
-        ps->setStencilBack(stencilOp);
-    }
+    for (auto it = pipelineTraceWarmUp.begin(); it != pipelineTraceWarmUp.end(); ) {
+        if (it.key().renderTargetDescription != rtDesc) {
+            ++it;
+            continue;
+        }
 
-    ps->setSampleCount(m_gstate.sampleCount);
+        QVarLengthArray<QRhiShaderResourceBinding, 8> bindings;
+        for (const PipelineTraceBinding &b : it.value()) {
+            if (b.type == QRhiShaderResourceBinding::UniformBuffer) {
+                if (!ubuf) {
+                    ubuf = rhi->newBuffer(QRhiBuffer::Dynamic, QRhiBuffer::UniformBuffer, 256);
+                    ubuf->create();
+                }
+                bindings.append(QRhiShaderResourceBinding::uniformBuffer(b.binding, b.stages, ubuf));
+            } else {
+                if (!texture) {
+                    texture = rhi->newTexture(QRhiTexture::RGBA8, QSize(1, 1));
+                    texture->create();
+                    sampler = rhi->newSampler(QRhiSampler::Nearest, QRhiSampler::Nearest, QRhiSampler::None,
+                                              QRhiSampler::ClampToEdge, QRhiSampler::ClampToEdge);
+                    sampler->create();
+                }
+                QVarLengthArray<QRhiShaderResourceBinding::TextureAndSampler, 4> textureSamplers;
+                for (int i = 0; i < b.count; ++i)
+                    textureSamplers.append({ texture, sampler });
+                bindings.append(QRhiShaderResourceBinding::sampledTextures(b.binding, b.stages, b.count,
+                                                                           textureSamplers.constData()));
+            }
+        }
 
-    ps->setLineWidth(m_gstate.lineWidth);
+        QRhiShaderResourceBindings *srb = rhi->newShaderResourceBindings();
+        srb->setBindings(bindings.cbegin(), bindings.cend());
+        if (srb->create()) {
+            if (QRhiGraphicsPipeline *ps = qsg_createGraphicsPipeline(rhi, it.key().state, it.key().shaderStages,
+                                                                      it.key().inputLayout, srb, rpDesc))
+            {
+                warmedUpPipelines.insert(it.key(), ps);
+                ++created;
+            }
+        }
+        delete srb;
 
-    if (!ps->create()) {
-        qWarning("Failed to build graphics pipeline state");
-        delete ps;
-        return false;
+        it = pipelineTraceWarmUp.erase(it);
     }
 
-    m_shaderManager->pipelineCache.insert(k, ps);
-    if (depthPostPass)
-        e->depthPostPassPs = ps;
-    else
-        e->ps = ps;
-    return true;
+    delete sampler;
+    delete texture;
+    delete ubuf;
+
+    pipelinesWarmedUp += created;
+    if (created) {
+        qCDebug(QSG_LOG_INFO, "Warmed up %d pipelines from the pipeline trace in %lld ms",
+                created, timer.elapsed());
+    }
+}
+
+QRhiGraphicsPipeline *ShaderManager::takeWarmedUpPipeline(const GraphicsPipelineStateKey &k)
+{
+    if (warmedUpPipelines.isEmpty())
+        return nullptr;
+
+    return warmedUpPipelines.take(PipelineTraceKey::create(k));
 }
 
 static QRhiSampler *newSampler(QRhi *rhi, const QSGSamplerDescription &desc)
@@ -3212,6 +3974,11 @@ void Renderer::renderMergedBatch(PreparedRenderBatch *renderBatch, bool depthPos
                            m_uint32IndexForRhi ? QRhiCommandBuffer::IndexUInt32 : QRhiCommandBuffer::IndexUInt16);
         cb->drawIndexed(draw.indexCount);
     }
+
+    if (m_frameReportEnabled) {
+        m_frameReport.vertexInputChanges += batch->drawSets.size();
+        m_frameReport.drawCalls += batch->drawSets.size();
+    }
 }
 
 bool Renderer::prepareRenderUnmergedBatch(Batch *batch, PreparedRenderBatch *renderBatch)
@@ -3393,9 +4160,8 @@ void Renderer::renderUnmergedBatch(PreparedRenderBatch *renderBatch, bool depthP
     if (batch->clipState.type & ClipState::StencilClip)
         enqueueStencilDraw(batch);
 
-    quint32 vOffset = 0;
-    quint32 iOffset = 0;
     QRhiCommandBuffer *cb = renderTarget().cb;
+    QRhiGraphicsPipeline *previousPs = nullptr;
 
     while (e) {
         QSGGeometry *g = e->node->geometry();
@@ -3404,22 +4170,36 @@ void Renderer::renderUnmergedBatch(PreparedRenderBatch *renderBatch, bool depthP
 
         setGraphicsPipeline(cb, batch, e, depthPostPass);
 
-        const QRhiCommandBuffer::VertexInput vbufBinding(batch->vbo.buf, vOffset);
+        // The vertex input of the previous element can be kept bound when
+        // this one shares its geometry and is drawn with the same pipeline.
+        QRhiGraphicsPipeline *ps = depthPostPass ? e->depthPostPassPs : e->ps;
+        const bool setVertexInput = !e->sharesGeometry || ps != previousPs;
+        previousPs = ps;
+
+        const QRhiCommandBuffer::VertexInput vbufBinding(batch->vbo.buf, e->vertexOffset);
+        bool drawn = false;
         if (g->indexCount()) {
             if (batch->ibo.buf) {
-                cb->setVertexInput(VERTEX_BUFFER_BINDING, 1, &vbufBinding,
-                                   batch->ibo.buf, iOffset,
-                                   effectiveIndexSize == sizeof(quint32) ? QRhiCommandBuffer::IndexUInt32
-                                                                         : QRhiCommandBuffer::IndexUInt16);
+                if (setVertexInput) {
+                    cb->setVertexInput(VERTEX_BUFFER_BINDING, 1, &vbufBinding,
+                                       batch->ibo.buf, e->indexOffset,
+                                       effectiveIndexSize == sizeof(quint32) ? QRhiCommandBuffer::IndexUInt32
+                                                                             : QRhiCommandBuffer::IndexUInt16);
+                }
                 cb->drawIndexed(g->indexCount());
+                drawn = true;
             }
         } else {
-            cb->setVertexInput(VERTEX_BUFFER_BINDING, 1, &vbufBinding);
+            if (setVertexInput)
+                cb->setVertexInput(VERTEX_BUFFER_BINDING, 1, &vbufBinding);
             cb->draw(g->vertexCount());
+            drawn = true;
         }
 
-        vOffset += g->sizeOfVertex() * g->vertexCount();
-        iOffset += g->indexCount() * effectiveIndexSize;
+        if (m_frameReportEnabled && drawn) {
+            m_frameReport.vertexInputChanges += setVertexInput ? 1 : 0;
+            m_frameReport.drawCalls += 1;
+        }
 
         e = e->nextInBatch;
     }
@@ -3427,7 +4207,12 @@ void Renderer::renderUnmergedBatch(PreparedRenderBatch *renderBatch, bool depthP
 
 void Renderer::setGraphicsPipeline(QRhiCommandBuffer *cb, const Batch *batch, Element *e, bool depthPostPass)
 {
-    cb->setGraphicsPipeline(depthPostPass ? e->depthPostPassPs : e->ps);
+    QRhiGraphicsPipeline *ps = depthPostPass ? e->depthPostPassPs : e->ps;
+    if (m_frameReportEnabled && ps != m_lastPipeline) {
+        m_lastPipeline = ps;
+        m_frameReport.pipelineChanges += 1;
+    }
+    cb->setGraphicsPipeline(ps);
 
     if (!m_pstate.viewportSet) {
         m_pstate.viewportSet = true;
@@ -3567,9 +4352,13 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
         ctx->timer.start();
     }
 
+    if (Q_UNLIKELY(m_shaderManager->hasPendingPipelineWarmUp()) && renderTarget().rpDesc)
+        m_shaderManager->warmUpPipelines(m_rhi, renderTarget().rpDesc);
+
     m_resourceUpdates = m_rhi->nextResourceUpdateBatch();
 
     if (m_rebuild & (BuildRenderLists | BuildRenderListsForTaggedRoots)) {
+        m_rebuildChanges |= QSGRendererFrameReport::NodesChanged;
         bool complete = (m_rebuild & BuildRenderLists) != 0;
         if (complete)
             buildRenderListsFromScratch();
@@ -3766,6 +4555,9 @@ void Renderer::prepareRenderPass(RenderPassContext *ctx)
     m_renderOrderRebuildUpper = -1;
 #endif
 
+    if (m_frameReportEnabled)
+        updateFrameReport();
+
     if (m_visualizer->mode() != Visualizer::VisualizeNothing)
         m_visualizer->prepareVisualize();
 
@@ -4007,6 +4799,79 @@ bool Renderer::hasVisualizationModeWithContinuousUpdate() const
     return m_visualizer->mode() == Visualizer::VisualizeOverdraw;
 }
 
+void Renderer::setFrameReportEnabled(bool enabled)
+{
+    if (m_frameReportEnabled == enabled)
+        return;
+
+    m_frameReportEnabled = enabled;
+    m_frameReport = QSGRendererFrameReport();
+
+    // Forget what was collected while the report was disabled
+    m_rebuildChanges = QSGRendererFrameReport::NoChange;
+    for (QDataBuffer<Batch *> *batches : { &m_opaqueBatches, &m_alphaBatches }) {
+        for (int i = 0; i < batches->size(); ++i) {
+            Batch *b = batches->at(i);
+            b->rebuilt = false;
+            b->changes = QSGRendererFrameReport::NoChange;
+            b->uploadedBytes = 0;
+        }
+    }
+}
+
+const QSGRendererFrameReport *Renderer::frameReport() const
+{
+    return m_frameReportEnabled ? &m_frameReport : nullptr;
+}
+
+/*
+    Summarizes the batches prepared for this frame, and resets what was
+    collected for them. The pipeline changes, vertex input changes and draw
+    calls are counted while recording the render pass, which happens after
+    this.
+ */
+void Renderer::updateFrameReport()
+{
+    m_frameReport = QSGRendererFrameReport();
+    m_frameReport.opaqueBatchCount = m_opaqueBatches.size();
+    m_frameReport.alphaBatchCount = m_alphaBatches.size();
+    m_frameReport.pipelinesWarmedUp = m_shaderManager->pipelinesWarmedUp;
+    m_frameReport.warmedUpPipelinesTaken = m_shaderManager->warmedUpPipelinesTaken;
+    m_frameReport.pipelinesCreated = m_shaderManager->pipelinesCreated;
+    m_frameReport.batches.reserve(m_opaqueBatches.size() + m_alphaBatches.size());
+    m_lastPipeline = nullptr;
+
+    for (QDataBuffer<Batch *> *batches : { &m_opaqueBatches, &m_alphaBatches }) {
+        for (int i = 0; i < batches->size(); ++i) {
+            Batch *b = batches->at(i);
+            QSGRendererFrameReport::Batch batch;
+            batch.opaque = b->isOpaque;
+            batch.merged = b->merged;
+            batch.rebuilt = b->rebuilt;
+            batch.vertexCount = b->vertexCount;
+            batch.indexCount = b->indexCount;
+            batch.sharedGeometryCount = b->merged ? 0 : b->sharedGeometryCount;
+            batch.uploadedBytes = b->uploadedBytes;
+            batch.changes = b->rebuilt ? b->changes | m_rebuildChanges : b->changes;
+            for (Element *e = b->first; e; e = e->nextInBatch)
+                ++batch.elementCount;
+
+            if (b->merged)
+                m_frameReport.mergedElementCount += batch.elementCount;
+            else
+                m_frameReport.unmergedElementCount += batch.elementCount;
+            m_frameReport.uploadedBytes += batch.uploadedBytes;
+            m_frameReport.batches.append(batch);
+
+            b->rebuilt = false;
+            b->changes = QSGRendererFrameReport::NoChange;
+            b->uploadedBytes = 0;
+        }
+    }
+
+    m_rebuildChanges = QSGRendererFrameReport::NoChange;
+}
+
 bool operator==(const GraphicsState &a, const GraphicsState &b) noexcept
 {
     return a.depthTest == b.depthTest
@@ -4068,6 +4933,43 @@ size_t qHash(const GraphicsPipelineStateKey &k, size_t seed) noexcept
         ^ k.extra.srbLayoutDescriptionHash;
 }
 
+PipelineTraceKey PipelineTraceKey::create(const GraphicsPipelineStateKey &k)
+{
+    return { k.state, k.sms->programRhi.shaderStages, k.sms->programRhi.inputLayout,
+             k.renderTargetDescription, k.srbLayoutDescription };
+}
+
+bool operator==(const PipelineTraceKey &a, const PipelineTraceKey &b) noexcept
+{
+    return a.state == b.state
+            && std::equal(a.shaderStages.cbegin(), a.shaderStages.cend(),
+                          b.shaderStages.cbegin(), b.shaderStages.cend(),
+                          [](const QRhiGraphicsShaderStage &x, const QRhiGraphicsShaderStage &y) {
+                              return x.type() == y.type()
+                                      && x.shaderVariant() == y.shaderVariant()
+                                      && x.shader() == y.shader();
+                          })
+            && a.inputLayout == b.inputLayout
+            && a.renderTargetDescription == b.renderTargetDescription
+            && a.srbLayoutDescription == b.srbLayoutDescription;
+}
+
+bool operator!=(const PipelineTraceKey &a, const PipelineTraceKey &b) noexcept
+{
+    return !(a == b);
+}
+
+size_t qHash(const PipelineTraceKey &k, size_t seed) noexcept
+{
+    size_t h = qHash(k.state, seed)
+            ^ qHash(k.inputLayout)
+            ^ qHash(k.renderTargetDescription)
+            ^ qHash(k.srbLayoutDescription);
+    for (const QRhiGraphicsShaderStage &stage : k.shaderStages)
+        h ^= qHash(stage.shader()) + stage.type();
+    return h;
+}
+
 Visualizer::Visualizer(Renderer *renderer)
     : m_renderer(renderer),
       m_visualizeMode(VisualizeNothing)
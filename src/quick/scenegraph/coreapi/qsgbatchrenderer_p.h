@@ -239,7 +239,7 @@ struct Rect {
         br.set(right, bottom);
     }
 
-    bool intersects(const Rect &r) {
+    bool intersects(const Rect &r) const {
         bool xOverlap = r.tl.x < br.x && r.br.x > tl.x;
         bool yOverlap = r.tl.y < br.y && r.br.y > tl.y;
         return xOverlap && yOverlap;
@@ -258,6 +258,43 @@ inline QDebug operator << (QDebug d, const Rect &r) {
     return d;
 }
 
+/*
+ * Uniform grid over the bounds of a contiguous range of elements in the alpha
+ * render list, [first(), end()). Used by checkOverlap() so that finding out if
+ * an element overlaps any of the elements rendered before it does not have to
+ * look at all of them.
+ */
+class OverlapGrid
+{
+public:
+    void reset(const Rect &extent, int elementCount);
+    void restart(int first);
+    void insert(const Rect &bounds);
+    void setEnd(int end) { m_end = end; }
+    bool intersects(const Rect &bounds) const;
+
+    bool isValid() const { return m_size > 0; }
+    int first() const { return m_first; }
+    int end() const { return m_end; }
+
+private:
+    int cellX(float x) const {
+        return int(qBound(0.0f, (x - m_extent.tl.x) * m_scaleX, float(m_size - 1)));
+    }
+    int cellY(float y) const {
+        return int(qBound(0.0f, (y - m_extent.tl.y) * m_scaleY, float(m_size - 1)));
+    }
+
+    Rect m_extent;
+    float m_scaleX = 0;
+    float m_scaleY = 0;
+    int m_size = 0;
+    int m_first = -1;
+    int m_end = -1;
+    QList<QList<Rect>> m_cells;
+    QList<int> m_usedCells;
+};
+
 struct Buffer {
     quint32 size;
     // Data is only valid while preparing the upload. Exception is if we are using the
@@ -276,6 +313,8 @@ struct Element {
         , orphaned(false)
         , isRenderNode(false)
         , isMaterialBlended(false)
+        , vertexTransformDirty(false)
+        , sharesGeometry(false)
     {
     }
 
@@ -298,6 +337,8 @@ struct Element {
     Rect bounds; // in device coordinates
 
     int order = 0;
+    quint32 vertexOffset = 0; // byte offset of the vertices in the batch's vbo
+    quint32 indexOffset = 0; // byte offset of the indices in an unmerged batch's ibo
     QRhiShaderResourceBindings *srb = nullptr;
     QRhiGraphicsPipeline *ps = nullptr;
     QRhiGraphicsPipeline *depthPostPassPs = nullptr;
@@ -309,6 +350,8 @@ struct Element {
     uint orphaned : 1;
     uint isRenderNode : 1;
     uint isMaterialBlended : 1;
+    uint vertexTransformDirty : 1;
+    uint sharesGeometry : 1; // same vertices and indices as the previous element in an unmerged batch
 };
 
 struct RenderNodeElement : public Element {
@@ -409,6 +452,7 @@ struct Batch
 
     bool isTranslateOnlyToRoot() const;
     bool isSafeToBatch() const;
+    bool isMergeableAfterTransformChange() const;
 
     // pseudo-constructor...
     void init() {
@@ -425,6 +469,11 @@ struct Batch
         isRenderNode = false;
         ubufDataValid = false;
         needsPurge = false;
+        needsTransformUpload = false;
+        rebuilt = true;
+        changes = QSGRendererFrameReport::NoChange;
+        uploadedBytes = 0;
+        sharedGeometryCount = 0;
         clipState.reset();
         blendConstant = QColor();
     }
@@ -436,6 +485,7 @@ struct Batch
 
     int vertexCount;
     int indexCount;
+    int sharedGeometryCount;
 
     int lastOrderInBatch;
 
@@ -445,9 +495,15 @@ struct Batch
     uint isRenderNode : 1;
     uint ubufDataValid : 1;
     uint needsPurge : 1;
+    uint needsTransformUpload : 1;
+    uint rebuilt : 1; // since the last frame report
 
     mutable uint uploadedThisFrame : 1; // solely for debugging purposes
 
+    // Collected for the frame report
+    QSGRendererFrameReport::Changes changes;
+    quint32 uploadedBytes;
+
     Buffer vbo;
     Buffer ibo;
     QRhiBuffer *ubuf;
@@ -640,6 +696,34 @@ bool operator==(const GraphicsPipelineStateKey &a, const GraphicsPipelineStateKe
 bool operator!=(const GraphicsPipelineStateKey &a, const GraphicsPipelineStateKey &b) noexcept;
 size_t qHash(const GraphicsPipelineStateKey &k, size_t seed = 0) noexcept;
 
+// Same as GraphicsPipelineStateKey, but referring to the shaders themselves
+// instead of a ShaderManagerShader, so that it remains meaningful across
+// processes. Used for recording pipeline traces and warming up from them.
+struct PipelineTraceKey
+{
+    GraphicsState state;
+    QVarLengthArray<QRhiGraphicsShaderStage, 2> shaderStages;
+    QRhiVertexInputLayout inputLayout;
+    QVector<quint32> renderTargetDescription;
+    QVector<quint32> srbLayoutDescription;
+    static PipelineTraceKey create(const GraphicsPipelineStateKey &k);
+};
+
+bool operator==(const PipelineTraceKey &a, const PipelineTraceKey &b) noexcept;
+bool operator!=(const PipelineTraceKey &a, const PipelineTraceKey &b) noexcept;
+size_t qHash(const PipelineTraceKey &k, size_t seed = 0) noexcept;
+
+// Enough of a shader resource binding to create a layout-compatible srb.
+struct PipelineTraceBinding
+{
+    int binding;
+    QRhiShaderResourceBinding::StageFlags stages;
+    QRhiShaderResourceBinding::Type type;
+    int count;
+};
+
+using PipelineTrace = QHash<PipelineTraceKey, QVector<PipelineTraceBinding>>;
+
 struct ShaderManagerShader
 {
     ~ShaderManagerShader() {
@@ -659,7 +743,7 @@ class ShaderManager : public QObject
 public:
     using Shader = ShaderManagerShader;
 
-    ShaderManager(QSGDefaultRenderContext *ctx) : context(ctx) { }
+    ShaderManager(QSGDefaultRenderContext *ctx);
     ~ShaderManager() {
         qDeleteAll(rewrittenShaders);
         qDeleteAll(stockShaders);
@@ -672,6 +756,18 @@ public:
     QMultiHash<QVector<quint32>, QRhiShaderResourceBindings *> srbPool;
     QVector<quint32> srbLayoutDescSerializeWorkspace;
 
+    bool isRecordingPipelines() const { return !pipelineTraceSaveFile.isEmpty(); }
+    void recordPipeline(const GraphicsPipelineStateKey &k, const QRhiShaderResourceBindings *srb);
+
+    bool hasPendingPipelineWarmUp() const { return !pipelineTraceWarmUp.isEmpty(); }
+    void warmUpPipelines(QRhi *rhi, QRhiRenderPassDescriptor *rpDesc);
+    QRhiGraphicsPipeline *takeWarmedUpPipeline(const GraphicsPipelineStateKey &k);
+
+    // Since the last invalidation, see QSGRendererFrameReport
+    int pipelinesWarmedUp = 0;
+    int warmedUpPipelinesTaken = 0;
+    int pipelinesCreated = 0;
+
 public Q_SLOTS:
     void invalidated();
 
@@ -684,6 +780,14 @@ private:
     QHash<ShaderKey, Shader *> rewrittenShaders;
     QHash<ShaderKey, Shader *> stockShaders;
 
+    void initPipelineTrace();
+
+    QString pipelineTraceSaveFile;
+    PipelineTrace pipelineTrace;
+    PipelineTrace pipelineTraceWarmUp;
+    QHash<PipelineTraceKey, QRhiGraphicsPipeline *> warmedUpPipelines;
+    QVector<quint32> lastWarmUpRenderTargetDescription;
+
     QSGDefaultRenderContext *context;
 };
 
@@ -795,7 +899,9 @@ private:
     void invalidateBatchAndOverlappingRenderOrders(Batch *batch);
 
     void uploadBatch(Batch *b);
-    void uploadMergedElement(Element *e, int vaOffset, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount);
+    void uploadMergedElement(Element *e, char **vertexData, char **zData, char **indexData, void *iBasePtr, int *indexCount);
+    void uploadMergedVertices(Batch *b);
+    void uploadMergedTransforms(Batch *b);
 
     bool ensurePipelineState(Element *e, const ShaderManager::Shader *sms, bool depthPostPass = false);
     QRhiTexture *dummyTexture();
@@ -839,6 +945,9 @@ private:
 
     void setVisualizationMode(const QByteArray &mode) override;
     bool hasVisualizationModeWithContinuousUpdate() const override;
+    void setFrameReportEnabled(bool enabled) override;
+    const QSGRendererFrameReport *frameReport() const override;
+    void updateFrameReport();
 
     QSGDefaultRenderContext *m_context;
     QSGRendererInterface::RenderMode m_renderMode;
@@ -870,9 +979,16 @@ private:
     int m_batchNodeThreshold;
     int m_batchVertexThreshold;
     int m_srbPoolThreshold;
+    int m_parallelUploadThreshold;
+    OverlapGrid m_overlapGrid;
 
     Visualizer *m_visualizer;
 
+    bool m_frameReportEnabled = false;
+    QSGRendererFrameReport m_frameReport;
+    QSGRendererFrameReport::Changes m_rebuildChanges; // why batches were rebuilt
+    const QRhiGraphicsPipeline *m_lastPipeline = nullptr;
+
     ShaderManager *m_shaderManager; // per rendercontext, shared
     QSGMaterial *m_currentMaterial;
     QSGMaterialShader *m_currentProgram;
@@ -4,12 +4,17 @@
 #include "qsggeometry.h"
 #include "qsggeometry_p.h"
 
-#ifdef Q_OS_QNX
-#include <malloc.h>
-#endif
+#include <private/qsgallocationcache_p.h>
 
 QT_BEGIN_NAMESPACE
 
+// The size of the vertex and index data allocated by QSGGeometry::allocate()
+static inline size_t qsg_dataByteSize(int stride, int vertexCount, int indexCount, int indexType)
+{
+    return size_t(stride) * vertexCount
+            + size_t(indexCount) * (indexType == QSGGeometry::UnsignedShortType ? sizeof(quint16) : sizeof(quint32));
+}
+
 
 QSGGeometry::Attribute QSGGeometry::Attribute::create(int attributeIndex, int tupleSize, int primitiveType, bool isPrimitive)
 {
@@ -429,7 +434,8 @@ QSGGeometry::QSGGeometry(const QSGGeometry::AttributeSet &attributes,
 QSGGeometry::~QSGGeometry()
 {
     if (m_owns_data)
-        free(m_data);
+        QSGAllocationCache::release(m_data, qsg_dataByteSize(m_attributes.stride, m_vertex_count,
+                                                             m_index_count, m_index_type));
 
     if (m_server_data)
         delete m_server_data;
@@ -605,24 +611,32 @@ void QSGGeometry::allocate(int vertexCount, int indexCount)
     if (vertexCount == m_vertex_count && indexCount == m_index_count)
         return;
 
+    const size_t oldByteSize = qsg_dataByteSize(m_attributes.stride, m_vertex_count,
+                                                m_index_count, m_index_type);
+
     m_vertex_count = vertexCount;
     m_index_count = indexCount;
 
     bool canUsePrealloc = m_index_count <= 0;
     int vertexByteSize = m_attributes.stride * m_vertex_count;
 
-    if (m_owns_data)
-        free(m_data);
-
     if (canUsePrealloc && vertexByteSize <= (int) sizeof(m_prealloc)) {
+        if (m_owns_data)
+            QSGAllocationCache::release(m_data, oldByteSize);
         m_data = (void *) &m_prealloc[0];
         m_index_data_offset = -1;
         m_owns_data = false;
     } else {
         Q_ASSERT(m_index_type == UnsignedIntType || m_index_type == UnsignedShortType);
-        int indexByteSize = indexCount * (m_index_type == UnsignedShortType ? sizeof(quint16) : sizeof(quint32));
-        m_data = (void *) malloc(vertexByteSize + indexByteSize);
-        Q_CHECK_PTR(m_data);
+        const size_t byteSize = qsg_dataByteSize(m_attributes.stride, m_vertex_count,
+                                                 m_index_count, m_index_type);
+        // Keep the current block if it is big enough, which saves releasing
+        // and allocating one for geometry that is resized often.
+        if (!m_owns_data || !QSGAllocationCache::canReuse(oldByteSize, byteSize)) {
+            if (m_owns_data)
+                QSGAllocationCache::release(m_data, oldByteSize);
+            m_data = QSGAllocationCache::allocate(byteSize);
+        }
         m_index_data_offset = vertexByteSize;
         m_owns_data = true;
     }
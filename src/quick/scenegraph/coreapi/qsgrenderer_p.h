@@ -55,6 +55,51 @@ public:
     QPaintDevice *paintDevice = nullptr;
 };
 
+// A summary of how the renderer batched and uploaded the scene in the last
+// frame it rendered. Meant for tracking down (and testing against) batching
+// regressions, see QQuickWindowPrivate::frameReport().
+struct QSGRendererFrameReport
+{
+    enum Change {
+        NoChange = 0x00,
+        NodesChanged = 0x01,
+        MaterialChanged = 0x02,
+        GeometryChanged = 0x04,
+        TransformChanged = 0x08,
+        Overlap = 0x10
+    };
+    Q_DECLARE_FLAGS(Changes, Change)
+
+    struct Batch {
+        bool opaque = false;
+        bool merged = false;
+        bool rebuilt = false; // the batch was built this frame
+        int elementCount = 0;
+        int vertexCount = 0;
+        int indexCount = 0;
+        int sharedGeometryCount = 0; // unmerged elements drawn from the vertices of the previous one
+        quint32 uploadedBytes = 0;
+        Changes changes; // why the batch was rebuilt or uploaded
+    };
+
+    int opaqueBatchCount = 0;
+    int alphaBatchCount = 0;
+    int mergedElementCount = 0;
+    int unmergedElementCount = 0;
+    quint64 uploadedBytes = 0;
+    int pipelineChanges = 0;
+    int vertexInputChanges = 0;
+    int drawCalls = 0;
+    // Running totals since the scenegraph was initialized, as pipelines are
+    // mostly created in the first frames only.
+    int pipelinesWarmedUp = 0; // created up front from the pipeline trace
+    int warmedUpPipelinesTaken = 0; // warmed up pipelines used by the renderer
+    int pipelinesCreated = 0; // created while preparing a frame
+    QList<Batch> batches;
+};
+
+Q_DECLARE_OPERATORS_FOR_FLAGS(QSGRendererFrameReport::Changes)
+
 class Q_QUICK_PRIVATE_EXPORT QSGRenderer : public QSGAbstractRenderer
 {
 public:
@@ -83,6 +128,8 @@ public:
     inline QSGMaterialShader::RenderState state(QSGMaterialShader::RenderState::DirtyStates dirty) const;
     virtual void setVisualizationMode(const QByteArray &) { }
     virtual bool hasVisualizationModeWithContinuousUpdate() const { return false; }
+    virtual void setFrameReportEnabled(bool) { }
+    virtual const QSGRendererFrameReport *frameReport() const { return nullptr; }
     virtual void releaseCachedResources() { }
 
     void clearChangedFlag() { m_changed_emitted = false; }
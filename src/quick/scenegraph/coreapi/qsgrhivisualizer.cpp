@@ -489,8 +489,6 @@ void RhiVisualizer::BatchVis::gather(Batch *b)
         }
     } else {
         Element *e = b->first;
-        int vOffset = 0;
-        int iOffset = 0;
 
         while (e) {
             QSGGeometryNode *gn = e->node;
@@ -502,17 +500,14 @@ void RhiVisualizer::BatchVis::gather(Batch *b)
             fillVertexIndex(&dc, g, false, forceUintIndex);
 
             dc.buf.vbuf = b->vbo.buf;
-            dc.buf.vbufOffset = vOffset;
+            dc.buf.vbufOffset = e->vertexOffset;
             if (g->indexCount()) {
                 dc.buf.ibuf = b->ibo.buf;
-                dc.buf.ibufOffset = iOffset;
+                dc.buf.ibufOffset = e->indexOffset;
             }
 
             drawCalls.append(dc);
 
-            vOffset += dc.vertex.count * dc.vertex.stride;
-            iOffset += dc.index.count * dc.index.stride;
-
             e = e->nextInBatch;
         }
     }
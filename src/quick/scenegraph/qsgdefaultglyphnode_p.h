@@ -17,11 +17,13 @@
 
 #include <private/qsgadaptationlayer_p.h>
 #include <private/qsgbasicglyphnode_p.h>
+#include <private/qsgallocationcache_p.h>
 
 QT_BEGIN_NAMESPACE
 
 class QSGDefaultGlyphNode : public QSGBasicGlyphNode
 {
+    QSG_DECLARE_CACHED_ALLOCATION
 public:
     QSGDefaultGlyphNode(QSGRenderContext *context);
     ~QSGDefaultGlyphNode();
@@ -22,6 +22,7 @@
 #include <qshareddata.h>
 #include <QtQuick/private/qsgplaintexture_p.h>
 #include <QtQuick/private/qsgrhitextureglyphcache_p.h>
+#include <QtQuick/private/qsgallocationcache_p.h>
 #include <qrawfont.h>
 #include <qmargins.h>
 
@@ -34,6 +35,7 @@ class QSGDefaultRenderContext;
 
 class QSGTextMaskMaterial: public QSGMaterial
 {
+    QSG_DECLARE_CACHED_ALLOCATION
 public:
     QSGTextMaskMaterial(QSGRenderContext *rc, const QVector4D &color, const QRawFont &font, QFontEngine::GlyphFormat glyphFormat = QFontEngine::Format_None);
     virtual ~QSGTextMaskMaterial();
@@ -19,6 +19,7 @@
 #include <private/qsgadaptationlayer_p.h>
 #include <private/qsgbasicinternalimagenode_p.h>
 #include <QtQuick/qsgtexturematerial.h>
+#include <private/qsgallocationcache_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -38,6 +39,7 @@ protected:
 
 class Q_QUICK_PRIVATE_EXPORT QSGDefaultInternalImageNode : public QSGBasicInternalImageNode
 {
+    QSG_DECLARE_CACHED_ALLOCATION
 public:
     QSGDefaultInternalImageNode(QSGDefaultRenderContext *rc);
 
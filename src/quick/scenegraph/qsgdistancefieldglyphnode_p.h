@@ -19,6 +19,7 @@
 #include <QtQuick/qsgtexture.h>
 
 #include <QtQuick/private/qquicktext_p.h>
+#include <QtQuick/private/qsgallocationcache_p.h>
 
 QT_BEGIN_NAMESPACE
 
@@ -27,6 +28,7 @@ class QSGDistanceFieldTextMaterial;
 
 class QSGDistanceFieldGlyphNode : public QSGGlyphNode, public QSGDistanceFieldGlyphConsumer
 {
+    QSG_DECLARE_CACHED_ALLOCATION
 public:
     QSGDistanceFieldGlyphNode(QSGRenderContext *context);
     ~QSGDistanceFieldGlyphNode();
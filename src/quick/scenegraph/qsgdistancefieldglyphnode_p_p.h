@@ -17,6 +17,7 @@
 
 #include <QtQuick/qsgmaterial.h>
 #include <QtQuick/private/qsgplaintexture_p.h>
+#include <QtQuick/private/qsgallocationcache_p.h>
 #include "qsgdistancefieldglyphnode_p.h"
 #include "qsgadaptationlayer_p.h"
 
@@ -26,6 +27,7 @@ class QSGPlainTexture;
 
 class Q_QUICK_PRIVATE_EXPORT QSGDistanceFieldTextMaterial: public QSGMaterial
 {
+    QSG_DECLARE_CACHED_ALLOCATION
 public:
     QSGDistanceFieldTextMaterial();
     ~QSGDistanceFieldTextMaterial();
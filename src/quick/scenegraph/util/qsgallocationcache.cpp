@@ -0,0 +1,137 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#include "qsgallocationcache_p.h"
+
+#include <QtCore/QThreadStorage>
+
+#include <stdlib.h>
+
+QT_BEGIN_NAMESPACE
+
+namespace {
+
+// Blocks up to 1 KB come in steps of 64 bytes, which is what most nodes and
+// small geometries need. Above that, there are two classes of 2 and 4 KB.
+// Larger blocks are not cached.
+const size_t SmallClassStep = 64;
+const size_t SmallClassLimit = 1024;
+const int SmallClassCount = SmallClassLimit / SmallClassStep;
+const int ClassCount = SmallClassCount + 2;
+
+// How much memory each class may keep around, per thread
+const size_t MaxCachedBytesPerClass = 32 * 1024;
+
+struct Block
+{
+    Block *next;
+};
+
+struct Cache
+{
+    ~Cache()
+    {
+        for (Block *head : heads) {
+            while (head) {
+                Block *next = head->next;
+                free(head);
+                head = next;
+            }
+        }
+    }
+
+    Block *heads[ClassCount] = {};
+    int counts[ClassCount] = {};
+};
+
+}
+
+Q_GLOBAL_STATIC(QThreadStorage<Cache *>, qsg_allocationCaches)
+
+static int qsg_sizeClass(size_t size)
+{
+    if (size <= SmallClassLimit)
+        return int((qMax(size, size_t(1)) - 1) / SmallClassStep);
+    if (size <= 2048)
+        return SmallClassCount;
+    if (size <= 4096)
+        return SmallClassCount + 1;
+    return -1;
+}
+
+static size_t qsg_classSize(int sizeClass)
+{
+    if (sizeClass < SmallClassCount)
+        return (sizeClass + 1) * SmallClassStep;
+    return sizeClass == SmallClassCount ? 2048 : 4096;
+}
+
+static bool qsg_isCacheEnabled()
+{
+    // Handy when looking for memory errors with tools that track the heap
+    static const bool enabled = !qEnvironmentVariableIntValue("QSG_NO_ALLOCATION_CACHE");
+    return enabled;
+}
+
+void *QSGAllocationCache::allocate(size_t size)
+{
+    const int sizeClass = qsg_sizeClass(size);
+    if (sizeClass < 0) {
+        void *ptr = malloc(size);
+        Q_CHECK_PTR(ptr);
+        return ptr;
+    }
+
+    if (qsg_isCacheEnabled() && !qsg_allocationCaches.isDestroyed()) {
+        QThreadStorage<Cache *> *caches = qsg_allocationCaches();
+        if (!caches->hasLocalData())
+            caches->setLocalData(new Cache);
+        Cache *cache = caches->localData();
+        if (Block *block = cache->heads[sizeClass]) {
+            cache->heads[sizeClass] = block->next;
+            --cache->counts[sizeClass];
+            return block;
+        }
+    }
+
+    // Always allocate the full size of the class, since the block may end
+    // up being cached and reused for any size in the class.
+    void *ptr = malloc(qsg_classSize(sizeClass));
+    Q_CHECK_PTR(ptr);
+    return ptr;
+}
+
+void QSGAllocationCache::release(void *ptr, size_t size)
+{
+    if (!ptr)
+        return;
+
+    const int sizeClass = qsg_sizeClass(size);
+    if (sizeClass >= 0 && qsg_isCacheEnabled() && !qsg_allocationCaches.isDestroyed()) {
+        // Only threads that allocate from the cache get one. This also
+        // avoids creating a cache for a thread that is about to finish.
+        QThreadStorage<Cache *> *caches = qsg_allocationCaches();
+        if (caches->hasLocalData()) {
+            Cache *cache = caches->localData();
+            if (size_t(cache->counts[sizeClass]) < MaxCachedBytesPerClass / qsg_classSize(sizeClass)) {
+                Block *block = static_cast<Block *>(ptr);
+                block->next = cache->heads[sizeClass];
+                cache->heads[sizeClass] = block;
+                ++cache->counts[sizeClass];
+                return;
+            }
+        }
+    }
+
+    free(ptr);
+}
+
+bool QSGAllocationCache::canReuse(size_t oldSize, size_t newSize)
+{
+    const int sizeClass = qsg_sizeClass(oldSize);
+    if (sizeClass < 0)
+        return oldSize == newSize;
+    return sizeClass == qsg_sizeClass(newSize);
+}
+
+QT_END_NAMESPACE
@@ -0,0 +1,53 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+#ifndef QSGALLOCATIONCACHE_P_H
+#define QSGALLOCATIONCACHE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the Qt API.  It exists purely as an
+// implementation detail.  This header file may change from version to
+// version without notice, or even be removed.
+//
+// We mean it.
+//
+
+#include <private/qtquickglobal_p.h>
+
+QT_BEGIN_NAMESPACE
+
+// Keeps small blocks of memory around for reuse when they are released,
+// instead of returning them to the heap right away. Scene graph nodes and
+// their geometry are created and destroyed in large numbers, for example when
+// delegates are created and destroyed while scrolling a view, and most of
+// them come in only a few sizes.
+//
+// The cache is per thread, so it needs no locking. A block may be released on
+// a different thread than the one it was allocated on.
+class Q_QUICK_PRIVATE_EXPORT QSGAllocationCache
+{
+public:
+    static void *allocate(size_t size);
+    static void release(void *ptr, size_t size);
+
+    // Returns true if a block allocated for oldSize bytes can be reused
+    // for newSize bytes.
+    static bool canReuse(size_t oldSize, size_t newSize);
+};
+
+// Makes the class allocate its instances from the QSGAllocationCache.
+// The class must have a virtual destructor if it has subclasses.
+#define QSG_DECLARE_CACHED_ALLOCATION                                       \
+public:                                                                     \
+    static void *operator new(size_t size)                                  \
+    { return QSGAllocationCache::allocate(size); }                          \
+    static void operator delete(void *ptr, size_t size)                     \
+    { QSGAllocationCache::release(ptr, size); }                             \
+private:
+
+QT_END_NAMESPACE
+
+#endif // QSGALLOCATIONCACHE_P_H
@@ -51,22 +51,26 @@ Manager::Manager(QSGDefaultRenderContext *rc, const QSize &surfacePixelSize, QSu
     m_atlas_size_limit = qt_sg_envInt("QSG_ATLAS_SIZE_LIMIT", qMax(w, h) / 2);
     m_atlas_size = QSize(w, h);
 
-    qCDebug(QSG_LOG_INFO, "rhi texture atlas dimensions: %dx%d", w, h);
+    // the number of atlases to put textures in before falling back to
+    // standalone textures
+    m_atlas_page_limit = qMax(1, qt_sg_envInt("QSG_ATLAS_PAGE_LIMIT", 4));
+
+    qCDebug(QSG_LOG_INFO, "rhi texture atlas dimensions: %dx%d, up to %d atlases", w, h, m_atlas_page_limit);
 }
 
 Manager::~Manager()
 {
-    Q_ASSERT(m_atlas == nullptr);
+    Q_ASSERT(m_atlas_pages.isEmpty());
     Q_ASSERT(m_atlases.isEmpty());
 }
 
 void Manager::invalidate()
 {
-    if (m_atlas) {
-        m_atlas->invalidate();
-        m_atlas->deleteLater();
-        m_atlas = nullptr;
+    for (Atlas *atlas : std::as_const(m_atlas_pages)) {
+        atlas->invalidate();
+        atlas->deleteLater();
     }
+    m_atlas_pages.clear();
 
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*>::iterator i = m_atlases.begin();
     while (i != m_atlases.end()) {
@@ -81,15 +85,48 @@ QSGTexture *Manager::create(const QImage &image, bool hasAlphaChannel)
 {
     Texture *t = nullptr;
     if (image.width() < m_atlas_size_limit && image.height() < m_atlas_size_limit) {
-        if (!m_atlas)
-            m_atlas = new Atlas(m_rc, m_atlas_size);
-        t = m_atlas->create(image);
+        releaseEmptyAtlases();
+
+        // Try the most recently used atlases first. The older ones are more
+        // likely to be fragmented, and this gives them a chance to empty out
+        // as their textures are released.
+        for (int i = 0; i < m_atlas_pages.size() && !t; ++i) {
+            t = m_atlas_pages.at(i)->create(image);
+            if (t && i > 0)
+                m_atlas_pages.move(i, 0);
+        }
+
+        if (!t && m_atlas_pages.size() < m_atlas_page_limit) {
+            Atlas *atlas = new Atlas(m_rc, m_atlas_size);
+            m_atlas_pages.prepend(atlas);
+            t = atlas->create(image);
+        }
+
         if (t && !hasAlphaChannel && t->hasAlphaChannel())
             t->setHasAlphaChannel(false);
     }
     return t;
 }
 
+void Manager::releaseEmptyAtlases()
+{
+    // An atlas without textures has no holes left in it, so keep the most
+    // recently used empty one around for new textures, and release the rest.
+    bool keptEmptyAtlas = false;
+    for (auto it = m_atlas_pages.begin(); it != m_atlas_pages.end(); ) {
+        Atlas *atlas = *it;
+        if (!atlas->isEmpty() || !keptEmptyAtlas) {
+            keptEmptyAtlas |= atlas->isEmpty();
+            ++it;
+            continue;
+        }
+        qCDebug(QSG_LOG_INFO, "releasing empty texture atlas %p", atlas);
+        atlas->release();
+        atlas->deleteLater();
+        it = m_atlas_pages.erase(it);
+    }
+}
+
 QSGTexture *Manager::create(const QSGCompressedTextureFactory *factory)
 {
     QSGTexture *t = nullptr;
@@ -134,6 +171,15 @@ void AtlasBase::invalidate()
     m_texture = nullptr;
 }
 
+void AtlasBase::release()
+{
+    // frames that are still in flight may be using the texture
+    if (m_texture) {
+        m_texture->deleteLater();
+        m_texture = nullptr;
+    }
+}
+
 void AtlasBase::commitTextureOperations(QRhiResourceUpdateBatch *resourceUpdates)
 {
     if (!m_allocated) {
@@ -155,6 +201,7 @@ void AtlasBase::remove(TextureBase *t)
     QRect atlasRect = t->atlasSubRect();
     m_allocator.deallocate(atlasRect);
     m_pending_uploads.removeOne(t);
+    --m_texture_count;
 }
 
 Atlas::Atlas(QSGDefaultRenderContext *rc, const QSize &size)
@@ -311,6 +358,7 @@ TextureBase::TextureBase(AtlasBase *atlas, const QRect &textureRect)
     , m_allocated_rect(textureRect)
     , m_atlas(atlas)
 {
+    ++m_atlas->m_texture_count;
 }
 
 TextureBase::~TextureBase()
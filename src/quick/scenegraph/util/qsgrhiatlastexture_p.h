@@ -50,14 +50,18 @@ public:
     void invalidate();
 
 private:
+    void releaseEmptyAtlases();
+
     QSGDefaultRenderContext *m_rc;
     QRhi *m_rhi;
-    Atlas *m_atlas = nullptr;
+    // atlases for uncompressed textures, the most recently used first
+    QVector<Atlas *> m_atlas_pages;
     // set of atlases for different compressed formats
     QHash<unsigned int, QSGCompressedAtlasTexture::Atlas*> m_atlases;
 
     QSize m_atlas_size;
     int m_atlas_size_limit;
+    int m_atlas_page_limit;
 };
 
 class AtlasBase : public QObject
@@ -68,8 +72,10 @@ public:
     ~AtlasBase();
 
     void invalidate();
+    void release();
     void commitTextureOperations(QRhiResourceUpdateBatch *resourceUpdates);
     void remove(TextureBase *t);
+    bool isEmpty() const { return m_texture_count == 0; }
 
     QSGDefaultRenderContext *renderContext() const { return m_rc; }
     QRhi *rhi() const { return m_rhi; }
@@ -87,6 +93,7 @@ protected:
     QRhiTexture *m_texture = nullptr;
     QSize m_size;
     QVector<TextureBase *> m_pending_uploads;
+    int m_texture_count = 0;
     friend class TextureBase;
     friend class TextureBasePrivate;
 
@@ -127,6 +134,7 @@ public:
 
     bool isAtlasTexture() const override { return true; }
     QRect atlasSubRect() const { return m_allocated_rect; }
+    AtlasBase *atlas() const { return m_atlas; }
 
 protected:
     QRect m_allocated_rect;
@@ -17,8 +17,8 @@ namespace QtQuickPrivate {
 
 static void cancelDeferred(QQmlData *ddata, int propertyIndex)
 {
-    auto dit = ddata->deferredData.rbegin();
-    while (dit != ddata->deferredData.rend()) {
+    auto dit = ddata->deferredData().rbegin();
+    while (dit != ddata->deferredData().rend()) {
         (*dit)->bindings.remove(propertyIndex);
         ++dit;
     }
@@ -28,12 +28,12 @@ static bool beginDeferred(QQmlEnginePrivate *enginePriv, const QQmlProperty &pro
 {
     QObject *object = property.object();
     QQmlData *ddata = QQmlData::get(object);
-    Q_ASSERT(!ddata->deferredData.isEmpty());
+    Q_ASSERT(ddata->hasDeferredData());
 
     int propertyIndex = property.index();
     int wasInProgress = enginePriv->inProgressCreations;
 
-    for (auto dit = ddata->deferredData.rbegin(); dit != ddata->deferredData.rend(); ++dit) {
+    for (auto dit = ddata->deferredData().rbegin(); dit != ddata->deferredData().rend(); ++dit) {
         QQmlData::DeferredData *deferData = *dit;
 
         auto bindings = deferData->bindings;
@@ -72,7 +72,7 @@ void beginDeferred(QObject *object, const QString &property,
                    QQuickUntypedDeferredPointer *delegate, bool isOwnState)
 {
     QQmlData *data = QQmlData::get(object);
-    if (data && !data->deferredData.isEmpty() && !data->wasDeleted(object) && data->context) {
+    if (data && data->hasDeferredData() && !data->wasDeleted(object) && data->context) {
         QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine());
 
         QQmlComponentPrivate::DeferredState state;
@@ -0,0 +1,35 @@
+import QtQuick
+import QtQml.Models
+
+Item {
+    id: root
+    property int created: 0
+    property var entries: [
+        { key: "a", text: "A" },
+        { key: "b", text: "B" },
+        { key: "c", text: "C" },
+        { key: "d", text: "D" }
+    ]
+
+    function replace() {
+        entries = [
+            { key: "d", text: "D" },
+            { key: "b", text: "B" },
+            { key: "e", text: "E" },
+            { key: "a", text: "A2" }
+        ]
+    }
+
+    Repeater {
+        objectName: "repeater"
+        model: DelegateModel {
+            keyRole: "key"
+            model: root.entries
+            delegate: Item {
+                property string key: modelData.key
+                property string text: modelData.text
+                Component.onCompleted: ++root.created
+            }
+        }
+    }
+}
@@ -0,0 +1,42 @@
+import QtQml
+import QtQml.Models
+
+DelegateModel {
+    id: delegateModel
+
+    property int maximumCost: 5
+
+    function names() {
+        let result = []
+        for (let i = 0; i < cheap.count; ++i)
+            result.push(cheap.get(i).model.name)
+        return result.join(",")
+    }
+
+    model: ListModel {
+        id: fruits
+        objectName: "fruits"
+        ListElement { name: "banana"; cost: 2 }
+        ListElement { name: "apple"; cost: 4 }
+        ListElement { name: "pear"; cost: 8 }
+        ListElement { name: "cherry"; cost: 1 }
+        ListElement { name: "melon"; cost: 6 }
+    }
+
+    groups: DelegateModelGroup {
+        id: cheap
+        objectName: "cheap"
+        name: "cheap"
+        filter: item => item.model.cost <= delegateModel.maximumCost
+        sortRole: "cost"
+    }
+    filterOnGroup: "cheap"
+
+    delegate: QtObject {}
+
+    function update() {
+        fruits.setProperty(2, "cost", 3)
+        fruits.append({ name: "grape", cost: 0 })
+        fruits.setProperty(0, "cost", 9)
+    }
+}
@@ -0,0 +1,34 @@
+import QtQml
+import QtQml.Models
+
+DelegateModel {
+    id: delegateModel
+
+    function names(groupName) {
+        const group = { items: delegateModel.items, small: small, sorted: sorted }[groupName]
+        let result = []
+        for (let i = 0; i < group.count; ++i)
+            result.push(group.get(i).model.display)
+        return result.join(",")
+    }
+
+    groups: [
+        DelegateModelGroup {
+            id: small
+            objectName: "small"
+            name: "small"
+            includeByDefault: true
+            filter: item => item.model.display.length <= 4
+        },
+        DelegateModelGroup {
+            id: sorted
+            objectName: "sorted"
+            name: "sorted"
+            includeByDefault: true
+            sortRole: "display"
+        }
+    ]
+    filterOnGroup: "small"
+
+    delegate: QtObject {}
+}
@@ -3,11 +3,13 @@
 
 #include <QtTest/qtest.h>
 #include <QtCore/QConcatenateTablesProxyModel>
+#include <QtCore/QStringListModel>
 #include <QtGui/QStandardItemModel>
 #include <QtQml/qqmlcomponent.h>
 #include <QtQmlModels/private/qqmldelegatemodel_p.h>
 #include <QtQuick/qquickview.h>
 #include <QtQuick/qquickitem.h>
+#include <QtQuick/private/qquickrepeater_p.h>
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 #include <QtTest/QSignalSpy>
 
@@ -26,6 +28,9 @@ private slots:
     void contextAccessedByHandler();
     void redrawUponColumnChange();
     void nestedDelegates();
+    void keyRole();
+    void sortAndFilter();
+    void sortAndFilterAfterResetAndClear();
 };
 
 class AbstractItemModel : public QAbstractItemModel
@@ -207,6 +212,120 @@ void tst_QQmlDelegateModel::nestedDelegates()
     QFAIL("Loader not found");
 }
 
+void tst_QQmlDelegateModel::keyRole()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("keyRole.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> root(c.create());
+    QVERIFY(root);
+
+    QQuickRepeater *repeater = root->findChild<QQuickRepeater *>("repeater");
+    QVERIFY(repeater);
+    QCOMPARE(repeater->count(), 4);
+    QCOMPARE(root->property("created").toInt(), 4);
+
+    QQuickItem *a = repeater->itemAt(0);
+    QQuickItem *b = repeater->itemAt(1);
+    QQuickItem *d = repeater->itemAt(3);
+
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "replace"));
+
+    // Only the delegate for the new entry is created, the others are kept
+    QCOMPARE(repeater->count(), 4);
+    QCOMPARE(root->property("created").toInt(), 5);
+    QCOMPARE(repeater->itemAt(0), d);
+    QCOMPARE(repeater->itemAt(1), b);
+    QCOMPARE(repeater->itemAt(2)->property("key").toString(), QStringLiteral("e"));
+    QCOMPARE(repeater->itemAt(3), a);
+    QCOMPARE(a->property("text").toString(), QStringLiteral("A2"));
+}
+
+void tst_QQmlDelegateModel::sortAndFilter()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("sortAndFilter.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> root(c.create());
+    QVERIFY(root);
+
+    QQmlDelegateModel *model = qobject_cast<QQmlDelegateModel *>(root.data());
+    QVERIFY(model);
+    const auto names = [&]() {
+        QVariant result;
+        QMetaObject::invokeMethod(model, "names", Q_RETURN_ARG(QVariant, result));
+        return result.toString();
+    };
+
+    QCOMPARE(names(), QStringLiteral("cherry,banana,apple"));
+    QCOMPARE(model->count(), 3);
+
+    // Changed and inserted items are filtered and put into place again
+    QVERIFY(QMetaObject::invokeMethod(model, "update"));
+    QCOMPARE(names(), QStringLiteral("grape,cherry,pear,apple"));
+    QCOMPARE(model->count(), 4);
+
+    // Changing the sort order sorts the group again
+    QQmlDelegateModelGroup *cheap = model->findChild<QQmlDelegateModelGroup *>("cheap");
+    QVERIFY(cheap);
+    QSignalSpy sortOrderSpy(cheap, &QQmlDelegateModelGroup::sortOrderChanged);
+    cheap->setSortOrder(Qt::DescendingOrder);
+    QCOMPARE(sortOrderSpy.size(), 1);
+    QCOMPARE(names(), QStringLiteral("apple,pear,cherry,grape"));
+
+    // Replacing the filter evaluates it for all items
+    cheap->setFilter(engine.evaluate(QStringLiteral("(item => item.model.cost > 3)")));
+    QCOMPARE(names(), QStringLiteral("banana,melon,apple"));
+
+    // Without a filter the group does not change membership on its own
+    cheap->setFilter(QJSValue());
+    QVERIFY(!cheap->filter().isCallable());
+    QCOMPARE(model->count(), 3);
+}
+
+void tst_QQmlDelegateModel::sortAndFilterAfterResetAndClear()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("sortAndFilterReset.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> root(c.create());
+    QVERIFY(root);
+
+    QQmlDelegateModel *model = qobject_cast<QQmlDelegateModel *>(root.data());
+    QVERIFY(model);
+    const auto names = [&](const QString &group) {
+        QVariant result;
+        QMetaObject::invokeMethod(model, "names", Q_RETURN_ARG(QVariant, result),
+                                  Q_ARG(QVariant, group));
+        return result.toString();
+    };
+
+    QStringListModel list({ "pear", "banana", "fig", "apple" });
+    model->setModel(QVariant::fromValue<QObject *>(&list));
+    QCOMPARE(names("items"), QStringLiteral("apple,banana,fig,pear"));
+    QCOMPARE(names("small"), QStringLiteral("fig,pear"));
+
+    // A reset of the model filters and sorts all items again
+    list.setStringList({ "kiwi", "cherry", "date", "lime", "grape" });
+    QCOMPARE(names("items"), QStringLiteral("cherry,date,grape,kiwi,lime"));
+    QCOMPARE(names("small"), QStringLiteral("date,kiwi,lime"));
+    QCOMPARE(model->count(), 3);
+
+    // Without a sort role the items are in the order of the model again
+    QQmlDelegateModelGroup *sorted = model->findChild<QQmlDelegateModelGroup *>("sorted");
+    QVERIFY(sorted);
+    sorted->setSortRole(QString());
+    QCOMPARE(names("items"), QStringLiteral("kiwi,cherry,date,lime,grape"));
+    QCOMPARE(names("small"), QStringLiteral("kiwi,date,lime"));
+
+    // Without a filter a group including items by default contains all of them
+    QQmlDelegateModelGroup *small = model->findChild<QQmlDelegateModelGroup *>("small");
+    QVERIFY(small);
+    small->setFilter(QJSValue());
+    QCOMPARE(names("small"), QStringLiteral("kiwi,cherry,date,lime,grape"));
+    QCOMPARE(model->count(), 5);
+}
+
 QTEST_MAIN(tst_QQmlDelegateModel)
 
 #include "tst_qqmldelegatemodel.moc"
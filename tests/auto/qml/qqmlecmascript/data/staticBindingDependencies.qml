@@ -0,0 +1,10 @@
+import QtQml
+
+QtObject {
+    property QtObject first: QtObject { property int value: 1 }
+    property QtObject second: QtObject { property int value: 10 }
+    property QtObject third: QtObject { property int value: 100 }
+
+    property int sum: first.value + second.value + third.value
+    property int picked: first.value > 1 ? second.value : third.value
+}
@@ -26,6 +26,7 @@
 #include <private/qv4objectiterator_p.h>
 #include <private/qqmlabstractbinding_p.h>
 #include <private/qqmlvaluetypeproxybinding_p.h>
+#include <private/qqmlbinding_p.h>
 #include <QtCore/private/qproperty_p.h>
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 #include <QtQuickTestUtils/private/testhttpserver_p.h>
@@ -412,6 +413,8 @@ private slots:
 
     void internalClassParentGc();
 
+    void staticBindingDependencies();
+
 private:
 //    static void propertyVarWeakRefCallback(v8::Persistent<v8::Value> object, void* parameter);
     static void verifyContextLifetime(const QQmlRefPointer<QQmlContextData> &ctxt);
@@ -10259,6 +10262,55 @@ void tst_qqmlecmascript::internalClassParentGc()
     QCOMPARE(root->objectName(), "3");
 }
 
+void tst_qqmlecmascript::staticBindingDependencies()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("staticBindingDependencies.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(root);
+
+    const auto bindingFunction = [&](const char *name) -> QV4::Function * {
+        const QQmlProperty property(root.data(), QLatin1String(name));
+        auto binding = static_cast<QQmlBinding *>(QQmlPropertyPrivate::binding(property));
+        return binding ? binding->function() : nullptr;
+    };
+
+    QV4::Function *sumFunction = bindingFunction("sum");
+    QVERIFY(sumFunction);
+    QVERIFY(sumFunction->hasStaticDependencies());
+    QV4::Function *pickedFunction = bindingFunction("picked");
+    QVERIFY(pickedFunction);
+    QVERIFY(!pickedFunction->hasStaticDependencies());
+
+    QCOMPARE(root->property("sum").toInt(), 111);
+    QCOMPARE(root->property("picked").toInt(), 100);
+
+    QObject *first = root->property("first").value<QObject *>();
+    QObject *second = root->property("second").value<QObject *>();
+    QObject *third = root->property("third").value<QObject *>();
+
+    // Swapping the source of one dependency must re-target its guard only.
+    root->setProperty("first", QVariant::fromValue(third));
+    QCOMPARE(root->property("sum").toInt(), 210);
+    QCOMPARE(root->property("picked").toInt(), 10);
+
+    first->setProperty("value", 5);
+    QCOMPARE(root->property("sum").toInt(), 210);
+
+    second->setProperty("value", 20);
+    QCOMPARE(root->property("sum").toInt(), 220);
+    QCOMPARE(root->property("picked").toInt(), 20);
+
+    third->setProperty("value", 0);
+    QCOMPARE(root->property("sum").toInt(), 20);
+    QCOMPARE(root->property("picked").toInt(), 0);
+
+    root->setProperty("first", QVariant::fromValue(first));
+    QCOMPARE(root->property("sum").toInt(), 25);
+    QCOMPARE(root->property("picked").toInt(), 20);
+}
+
 QTEST_MAIN(tst_qqmlecmascript)
 
 #include "tst_qqmlecmascript.moc"
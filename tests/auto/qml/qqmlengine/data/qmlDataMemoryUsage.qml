@@ -0,0 +1,9 @@
+import QtQml
+
+QtObject {
+    property QtObject first: QtObject {}
+    property QtObject second: QtObject {
+        property int x: 5
+        property int y: x * 2
+    }
+}
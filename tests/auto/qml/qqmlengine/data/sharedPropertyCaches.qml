@@ -0,0 +1,12 @@
+import QtQml
+
+QtObject {
+    property int count: 5
+    property string label: "shared"
+    signal triggered(int value)
+    function twice(value: int): int { return value * 2 }
+
+    property QtObject child: QtObject {
+        property real ratio: 0.5
+    }
+}
@@ -0,0 +1,5 @@
+import QtQml
+
+QtObject {
+    property SharedPropertyCachesComposite composite: SharedPropertyCachesComposite {}
+}
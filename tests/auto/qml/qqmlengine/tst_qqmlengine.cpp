@@ -19,6 +19,7 @@
 #include <private/qqmlengine_p.h>
 #include <private/qqmltypedata_p.h>
 #include <private/qqmlcomponentattached_p.h>
+#include <private/qqmldata_p.h>
 #include <QQmlAbstractUrlInterceptor>
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 
@@ -72,6 +73,8 @@ private slots:
     void qtNamespaceInQtObject();
     void nativeModuleImport();
     void lockedRootObject();
+    void qmlDataMemoryUsage();
+    void sharedPropertyCaches();
 
 public slots:
     QObject *createAQObjectForOwnershipTest ()
@@ -1661,6 +1664,89 @@ void tst_qqmlengine::lockedRootObject()
     QCOMPARE(o->property("defineProperty2").toBool(), false);
 }
 
+void tst_qqmlengine::qmlDataMemoryUsage()
+{
+    QQmlEngine engine;
+    QQmlComponent c(&engine, testFileUrl("qmlDataMemoryUsage.qml"));
+    QVERIFY2(c.isReady(), qPrintable(c.errorString()));
+    QScopedPointer<QObject> o(c.create());
+    QVERIFY(o);
+
+    QCOMPARE(QQmlData::memoryUsage(nullptr).objectCount, 0);
+
+    const QQmlData::MemoryUsage usage = QQmlData::memoryUsage(o.data());
+    QCOMPARE(usage.objectCount, 3);
+    QVERIFY(usage.qmlDataBytes >= qsizetype(sizeof(QQmlData)));
+    QCOMPARE(usage.deferredDataBytes, 0);
+
+    // The binding on "y" listens to "x", which needs a notify list on the inner object.
+    QVERIFY(usage.notifyListBytes > 0);
+    QCOMPARE(usage.totalBytes(), usage.qmlDataBytes + usage.bindingBitsBytes
+                     + usage.notifyListBytes + usage.extendedDataBytes);
+
+    QObject *second = o->property("second").value<QObject *>();
+    QVERIFY(second);
+    const QQmlData::MemoryUsage secondUsage = QQmlData::memoryUsage(second);
+    QCOMPARE(secondUsage.objectCount, 1);
+    QVERIFY(secondUsage.notifyListBytes > 0);
+    QCOMPARE(secondUsage.extendedDataBytes, 0);
+}
+
+void tst_qqmlengine::sharedPropertyCaches()
+{
+    QQmlEngine engine1;
+    QQmlEngine engine2;
+
+    const auto create = [this](QQmlEngine *engine, const char *file) {
+        QQmlComponent c(engine, testFileUrl(file));
+        if (!c.isReady())
+            qWarning() << c.errorString();
+        return std::unique_ptr<QObject>(c.create());
+    };
+
+    {
+        const std::unique_ptr<QObject> o1 = create(&engine1, "sharedPropertyCaches.qml");
+        const std::unique_ptr<QObject> o2 = create(&engine2, "sharedPropertyCaches.qml");
+        QVERIFY(o1);
+        QVERIFY(o2);
+        QCOMPARE(QQmlData::get(o1.get())->propertyCache, QQmlData::get(o2.get())->propertyCache);
+
+        QObject *child1 = o1->property("child").value<QObject *>();
+        QObject *child2 = o2->property("child").value<QObject *>();
+        QVERIFY(child1);
+        QVERIFY(child2);
+        QCOMPARE(QQmlData::get(child1)->propertyCache, QQmlData::get(child2)->propertyCache);
+
+        // Both instances still behave independently.
+        o1->setProperty("count", 7);
+        QCOMPARE(o2->property("count").toInt(), 5);
+        QCOMPARE(o1->metaObject()->className(), o2->metaObject()->className());
+    }
+
+    {
+        // The class names of named composite types are numbered per process, but the root
+        // caches are still shared.
+        const std::unique_ptr<QObject> o1 = create(&engine1, "SharedPropertyCachesComposite.qml");
+        const std::unique_ptr<QObject> o2 = create(&engine2, "SharedPropertyCachesComposite.qml");
+        QVERIFY(o1);
+        QVERIFY(o2);
+        QCOMPARE(QQmlData::get(o1.get())->propertyCache, QQmlData::get(o2.get())->propertyCache);
+        QVERIFY(QByteArray(o1->metaObject()->className())
+                        .startsWith("SharedPropertyCachesComposite_QMLTYPE_"));
+        QCOMPARE(o2->property("value").toInt(), 1);
+    }
+
+    {
+        // Composite types are registered per engine. Caches referring to them can't be shared.
+        const std::unique_ptr<QObject> o1 = create(&engine1, "unsharedPropertyCaches.qml");
+        const std::unique_ptr<QObject> o2 = create(&engine2, "unsharedPropertyCaches.qml");
+        QVERIFY(o1);
+        QVERIFY(o2);
+        QVERIFY(QQmlData::get(o1.get())->propertyCache
+                != QQmlData::get(o2.get())->propertyCache);
+    }
+}
+
 QTEST_MAIN(tst_qqmlengine)
 
 #include "tst_qqmlengine.moc"
@@ -47,6 +47,7 @@ private slots:
     void garbageCollection();
     void requiredProperties();
     void deleteInSetInitialState();
+    void priorities();
 
 private:
     QQmlIncubationController controller;
@@ -1240,6 +1241,69 @@ void tst_qqmlincubator::deleteInSetInitialState()
     QCOMPARE(incubator.object(), nullptr); // object was deleted
 }
 
+void tst_qqmlincubator::priorities()
+{
+    QQmlComponent component(&engine, testFileUrl("priorities.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+
+    QStringList completed;
+    class NamedIncubator : public QQmlIncubator
+    {
+    public:
+        NamedIncubator(const QString &name, QStringList *completed)
+            : name(name), completed(completed)
+        {}
+
+        void setPriority(QQmlIncubatorPrivate::Priority priority)
+        {
+            QQmlIncubatorPrivate::get(this)->setPriority(priority);
+        }
+
+    protected:
+        void statusChanged(Status status) override
+        {
+            if (status == Ready)
+                completed->append(name);
+        }
+
+    private:
+        QString name;
+        QStringList *completed;
+    };
+
+    NamedIncubator low(QStringLiteral("low"), &completed);
+    NamedIncubator normal(QStringLiteral("normal"), &completed);
+    NamedIncubator high(QStringLiteral("high"), &completed);
+    NamedIncubator raised(QStringLiteral("raised"), &completed);
+
+    low.setPriority(QQmlIncubatorPrivate::LowPriority);
+    high.setPriority(QQmlIncubatorPrivate::HighPriority);
+    component.create(high);
+    component.create(low);
+    component.create(normal);
+
+    // Raising the priority of a queued incubator moves it ahead of the others.
+    component.create(raised);
+    raised.setPriority(QQmlIncubatorPrivate::LowPriority);
+    raised.setPriority(QQmlIncubatorPrivate::HighPriority);
+
+    QCOMPARE(controller.incubatingObjectCount(), 4);
+    while (controller.incubatingObjectCount() > 0) {
+        std::atomic<bool> b{false};
+        controller.incubateWhile(&b);
+    }
+
+    QCOMPARE(completed, (QStringList {
+        QStringLiteral("raised"), QStringLiteral("high"),
+        QStringLiteral("normal"), QStringLiteral("low") }));
+    QCOMPARE(low.object()->property("value").toInt(), 5);
+
+    delete low.object();
+    delete normal.object();
+    delete high.object();
+    delete raised.object();
+}
+
 QTEST_MAIN(tst_qqmlincubator)
 
 #include "tst_qqmlincubator.moc"
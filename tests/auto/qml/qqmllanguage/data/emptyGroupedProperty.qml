@@ -0,0 +1,6 @@
+import Test 1.0
+
+MyTypeObject {
+    grouped {}
+    rectProperty {}
+}
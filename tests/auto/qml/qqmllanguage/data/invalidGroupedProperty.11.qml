@@ -0,0 +1,5 @@
+import Test 1.0
+
+MyTypeObject {
+    nullGrouped {}
+}
@@ -85,6 +85,7 @@ private slots:
     void interfaceQList();
     void assignObjectToSignal();
     void assignObjectToVariant();
+    void emptyGroupedProperty();
     void assignLiteralSignalProperty();
     void assignQmlComponent();
     void assignValueTypes();
@@ -586,6 +587,7 @@ void tst_qqmllanguage::errors_data()
     QTest::newRow("invalidGroupedProperty.8") << "invalidGroupedProperty.8.qml" << "invalidGroupedProperty.8.errors.txt" << false;
     QTest::newRow("invalidGroupedProperty.9") << "invalidGroupedProperty.9.qml" << "invalidGroupedProperty.9.errors.txt" << false;
     QTest::newRow("invalidGroupedProperty.10") << "invalidGroupedProperty.10.qml" << "invalidGroupedProperty.10.errors.txt" << false;
+    QTest::newRow("invalidGroupedProperty.11") << "invalidGroupedProperty.11.qml" << "invalidGroupedProperty.11.errors.txt" << true;
 
     QTest::newRow("importNamespaceConflict") << "importNamespaceConflict.qml" << "importNamespaceConflict.errors.txt" << false;
     QTest::newRow("importVersionMissing (builtin)") << "importVersionMissingBuiltIn.qml" << "importVersionMissingBuiltIn.errors.txt" << false;
@@ -824,6 +826,16 @@ void tst_qqmllanguage::assignObjectToVariant()
     QVERIFY(v.typeId() == qMetaTypeId<QObject *>());
 }
 
+void tst_qqmllanguage::emptyGroupedProperty()
+{
+    // Empty groups are accepted without assigning anything. Empty groups on
+    // null objects are still rejected, see invalidGroupedProperty.11.
+    QQmlComponent component(&engine, testFileUrl("emptyGroupedProperty.qml"));
+    VERIFY_ERRORS(0);
+    QScopedPointer<MyTypeObject> object(qobject_cast<MyTypeObject *>(component.create()));
+    QVERIFY2(object, qPrintable(component.errorString()));
+}
+
 void tst_qqmllanguage::assignLiteralSignalProperty()
 {
     QQmlComponent component(&engine, testFileUrl("assignLiteralSignalProperty.qml"));
@@ -5013,13 +5025,13 @@ void tst_qqmllanguage::deferredProperties()
     QQmlData *qmlData = QQmlData::get(object.data());
     QVERIFY(qmlData);
 
-    QCOMPARE(qmlData->deferredData.size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
-    QCOMPARE(qmlData->deferredData.first()->bindings.size(), 3); // "innerobj", "innerlist1", "innerlist2"
-    QCOMPARE(qmlData->deferredData.last()->bindings.size(), 3); // "outerobj", "outerlist1", "outerlist2"
+    QCOMPARE(qmlData->deferredData().size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
+    QCOMPARE(qmlData->deferredData().first()->bindings.size(), 3); // "innerobj", "innerlist1", "innerlist2"
+    QCOMPARE(qmlData->deferredData().last()->bindings.size(), 3); // "outerobj", "outerlist1", "outerlist2"
 
     qmlExecuteDeferred(object.data());
 
-    QCOMPARE(qmlData->deferredData.size(), 0);
+    QCOMPARE(qmlData->deferredData().size(), 0);
 
     innerObj = object->findChild<QObject *>(QStringLiteral("innerobj")); // MyDeferredListProperty.qml
     QVERIFY(innerObj);
@@ -5051,11 +5063,11 @@ static void beginDeferredOnce(QQmlEnginePrivate *enginePriv,
 {
     QObject *object = property.object();
     QQmlData *ddata = QQmlData::get(object);
-    Q_ASSERT(!ddata->deferredData.isEmpty());
+    Q_ASSERT(ddata->hasDeferredData());
 
     int propertyIndex = property.index();
 
-    for (auto dit = ddata->deferredData.rbegin(); dit != ddata->deferredData.rend(); ++dit) {
+    for (auto dit = ddata->deferredData().rbegin(); dit != ddata->deferredData().rend(); ++dit) {
         QQmlData::DeferredData *deferData = *dit;
 
         auto range = deferData->bindings.equal_range(propertyIndex);
@@ -5083,7 +5095,7 @@ static void beginDeferredOnce(QQmlEnginePrivate *enginePriv,
 
         // Cleanup any remaining deferred bindings for this property, also in inner contexts,
         // to avoid executing them later and overriding the property that was just populated.
-        while (dit != ddata->deferredData.rend()) {
+        while (dit != ddata->deferredData().rend()) {
             (*dit)->bindings.remove(propertyIndex);
             ++dit;
         }
@@ -5095,7 +5107,7 @@ static void testExecuteDeferredOnce(const QQmlProperty &property)
 {
     QObject *object = property.object();
     QQmlData *data = QQmlData::get(object);
-    if (data && !data->deferredData.isEmpty() && !data->wasDeleted(object)) {
+    if (data && data->hasDeferredData() && !data->wasDeleted(object)) {
         QQmlEnginePrivate *ep = QQmlEnginePrivate::get(data->context->engine());
 
         QQmlComponentPrivate::DeferredState state;
@@ -5130,16 +5142,16 @@ void tst_qqmllanguage::executeDeferredPropertiesOnce()
     QQmlData *qmlData = QQmlData::get(object.data());
     QVERIFY(qmlData);
 
-    QCOMPARE(qmlData->deferredData.size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
-    QCOMPARE(qmlData->deferredData.first()->bindings.size(), 3); // "innerobj", "innerlist1", "innerlist2"
-    QCOMPARE(qmlData->deferredData.last()->bindings.size(), 3); // "outerobj", "outerlist1", "outerlist2"
+    QCOMPARE(qmlData->deferredData().size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
+    QCOMPARE(qmlData->deferredData().first()->bindings.size(), 3); // "innerobj", "innerlist1", "innerlist2"
+    QCOMPARE(qmlData->deferredData().last()->bindings.size(), 3); // "outerobj", "outerlist1", "outerlist2"
 
     // first execution creates the outer object
     testExecuteDeferredOnce(QQmlProperty(object.data(), "groupProperty"));
 
-    QCOMPARE(qmlData->deferredData.size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
-    QCOMPARE(qmlData->deferredData.first()->bindings.size(), 2); // "innerlist1", "innerlist2"
-    QCOMPARE(qmlData->deferredData.last()->bindings.size(), 2); // "outerlist1", "outerlist2"
+    QCOMPARE(qmlData->deferredData().size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
+    QCOMPARE(qmlData->deferredData().first()->bindings.size(), 2); // "innerlist1", "innerlist2"
+    QCOMPARE(qmlData->deferredData().last()->bindings.size(), 2); // "outerlist1", "outerlist2"
 
     QObjectList innerObjsAfterFirstExecute = object->findChildren<QObject *>(QStringLiteral("innerobj")); // MyDeferredListProperty.qml
     QVERIFY(innerObjsAfterFirstExecute.isEmpty());
@@ -5157,9 +5169,9 @@ void tst_qqmllanguage::executeDeferredPropertiesOnce()
     // re-execution does nothing (to avoid overriding the property)
     testExecuteDeferredOnce(QQmlProperty(object.data(), "groupProperty"));
 
-    QCOMPARE(qmlData->deferredData.size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
-    QCOMPARE(qmlData->deferredData.first()->bindings.size(), 2); // "innerlist1", "innerlist2"
-    QCOMPARE(qmlData->deferredData.last()->bindings.size(), 2); // "outerlist1", "outerlist2"
+    QCOMPARE(qmlData->deferredData().size(), 2); // MyDeferredListProperty.qml + deferredListProperty.qml
+    QCOMPARE(qmlData->deferredData().first()->bindings.size(), 2); // "innerlist1", "innerlist2"
+    QCOMPARE(qmlData->deferredData().last()->bindings.size(), 2); // "outerlist1", "outerlist2"
 
     QObjectList innerObjsAfterSecondExecute = object->findChildren<QObject *>(QStringLiteral("innerobj")); // MyDeferredListProperty.qml
     QVERIFY(innerObjsAfterSecondExecute.isEmpty());
@@ -5176,7 +5188,7 @@ void tst_qqmllanguage::executeDeferredPropertiesOnce()
     // execution of a list property should execute all outer list bindings
     testExecuteDeferredOnce(QQmlProperty(object.data(), "listProperty"));
 
-    QCOMPARE(qmlData->deferredData.size(), 0);
+    QCOMPARE(qmlData->deferredData().size(), 0);
 
     listProperty = object->property("listProperty").value<QQmlListProperty<QObject>>();
     QCOMPARE(listProperty.count(&listProperty), 2);
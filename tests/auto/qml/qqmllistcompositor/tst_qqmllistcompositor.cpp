@@ -110,6 +110,8 @@ class tst_qqmllistcompositor : public QObject
 private slots:
     void find_data();
     void find();
+    void findFragmented();
+    void findFragmentedAfterChanges();
     void findInsertPosition_data();
     void findInsertPosition();
     void insert();
@@ -193,6 +195,117 @@ void tst_qqmllistcompositor::find()
     QCOMPARE(it->index, rangeIndex);
 }
 
+void tst_qqmllistcompositor::findFragmented()
+{
+    int listA; void *a = &listA;
+
+    QQmlListCompositor compositor;
+    compositor.setGroupCount(4);
+
+    // Alternate the membership of the visible group so that no ranges can be joined.
+    const int count = 2000;
+    for (int i = 0; i < count; ++i)
+        compositor.append(a, i, 1, C::DefaultFlag | (i % 2 ? 0 : VisibleFlag));
+    QCOMPARE(compositor.count(Visible), count / 2);
+
+    // Jump back and forth to look up items far away from the previous one.
+    for (int i = 0; i < count / 2; ++i) {
+        const int index = i % 2 ? count / 2 - 1 - i : i;
+        C::iterator it = compositor.find(Visible, index);
+        QCOMPARE(it.index[Visible], index);
+        QCOMPARE(it.index[C::Default], 2 * index);
+        QCOMPARE(it.modelIndex(), 2 * index);
+    }
+
+    // Modifying the compositor discards the lookup state of the old ranges.
+    compositor.clearFlags(C::Default, 0, 2, VisibleFlag);
+    compositor.setFlags(C::Default, count - 1, 1, VisibleFlag);
+    QCOMPARE(compositor.count(Visible), count / 2);
+
+    C::iterator it = compositor.find(Visible, count / 2 - 1);
+    QCOMPARE(it.index[C::Default], count - 1);
+    QCOMPARE(it.modelIndex(), count - 1);
+
+    it = compositor.find(Visible, 0);
+    QCOMPARE(it.index[C::Default], 2);
+    QCOMPARE(it.modelIndex(), 2);
+
+    it = compositor.find(C::Default, count / 2);
+    QCOMPARE(it.index[Visible], count / 4 - 1);
+    QCOMPARE(it.modelIndex(), count / 2);
+}
+
+void tst_qqmllistcompositor::findFragmentedAfterChanges()
+{
+    // Modifications only discard the part of the range index after them. Check that
+    // lookups on both sides of a change stay correct after inserting, moving and
+    // changing the flags of items in the middle of a fragmented compositor.
+    int listA; void *a = &listA;
+
+    QQmlListCompositor compositor;
+    compositor.setGroupCount(4);
+
+    // The model index and visibility of each item in the default group.
+    QVector<std::pair<int, bool>> items;
+    const int count = 2000;
+    for (int i = 0; i < count; ++i) {
+        items.append({ i, i % 2 == 0 });
+        compositor.append(a, i, 1, C::DefaultFlag | (i % 2 ? 0 : VisibleFlag));
+    }
+
+    int nextModelIndex = count;
+    quint32 seed = 1;
+    const auto random = [&seed](int bound) {
+        seed = seed * 1103515245 + 12345;
+        return int((seed >> 16) % quint32(bound));
+    };
+
+    for (int step = 0; step < 300; ++step) {
+        const int index = random(items.size());
+        switch (step % 4) {
+        case 0:
+            compositor.setFlags(C::Default, index, 1, VisibleFlag);
+            items[index].second = true;
+            break;
+        case 1:
+            compositor.clearFlags(C::Default, index, 1, VisibleFlag);
+            items[index].second = false;
+            break;
+        case 2: {
+            const bool visible = random(2);
+            compositor.insert(C::Default, index, a, nextModelIndex, 1,
+                              C::DefaultFlag | (visible ? VisibleFlag : 0));
+            items.insert(index, { nextModelIndex++, visible });
+            break;
+        }
+        case 3: {
+            const int to = random(items.size());
+            compositor.move(C::Default, index, C::Default, to, 1, C::Default);
+            items.move(index, to);
+            break;
+        }
+        }
+
+        QVector<int> visibleItems;
+        for (const auto &item : std::as_const(items)) {
+            if (item.second)
+                visibleItems.append(item.first);
+        }
+        QCOMPARE(compositor.count(C::Default), items.size());
+        QCOMPARE(compositor.count(Visible), visibleItems.size());
+
+        // Look up items far apart, in front of and after the change.
+        for (int i = 0; i < 4; ++i) {
+            const int defaultIndex = random(items.size());
+            QCOMPARE(compositor.find(C::Default, defaultIndex).modelIndex(),
+                     items.at(defaultIndex).first);
+            const int visibleIndex = random(visibleItems.size());
+            QCOMPARE(compositor.find(Visible, visibleIndex).modelIndex(),
+                     visibleItems.at(visibleIndex));
+        }
+    }
+}
+
 void tst_qqmllistcompositor::findInsertPosition_data()
 {
     QTest::addColumn<RangeList>("ranges");
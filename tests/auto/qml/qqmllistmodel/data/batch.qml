@@ -0,0 +1,35 @@
+import QtQml
+import QtQml.Models
+
+QtObject {
+    property ListModel model: ListModel {
+        ListElement { name: "a"; cost: 1 }
+        ListElement { name: "b"; cost: 2 }
+        ListElement { name: "c"; cost: 3 }
+        ListElement { name: "d"; cost: 4 }
+        ListElement { name: "e"; cost: 5 }
+    }
+
+    function updateCosts() {
+        model.beginBatch()
+        for (let i = 1; i < 4; ++i)
+            model.setProperty(i, "cost", i * 10)
+        model.beginBatch()
+        model.set(2, { name: "c2" })
+        model.endBatch()
+        model.endBatch()
+    }
+
+    function updateAndAppend() {
+        model.beginBatch()
+        model.setProperty(0, "cost", 100)
+        model.append({ name: "f", cost: 6 })
+        model.append({ name: "g", cost: 7 })
+        model.setProperty(4, "cost", 40)
+        model.endBatch()
+    }
+
+    function unbalancedEnd() {
+        model.endBatch()
+    }
+}
@@ -13,6 +13,7 @@
 #include <QtCore/qtimer.h>
 #include <QtCore/qdebug.h>
 #include <QtCore/qtranslator.h>
+#include <QtCore/qregularexpression.h>
 #include <QSignalSpy>
 
 #include <QtQuickTestUtils/private/qmlutils_p.h>
@@ -118,6 +119,9 @@ private slots:
     void destroyComponentObject();
     void objectOwnershipFlip();
     void enumsInListElement();
+    void bulkInsert_data();
+    void bulkInsert();
+    void batch();
 };
 
 bool tst_qqmllistmodel::compareVariantList(const QVariantList &testList, QVariant object)
@@ -1909,6 +1913,108 @@ void tst_qqmllistmodel::enumsInListElement()
     }
 }
 
+void tst_qqmllistmodel::bulkInsert_data()
+{
+    QTest::addColumn<bool>("dynamicRoles");
+
+    QTest::newRow("staticRoles") << false;
+    QTest::newRow("dynamicRoles") << true;
+}
+
+void tst_qqmllistmodel::bulkInsert()
+{
+    QFETCH(bool, dynamicRoles);
+
+    QQmlEngine engine;
+    QQmlListModel model;
+    model.setDynamicRoles(dynamicRoles);
+    QQmlEngine::setContextForObject(&model, engine.rootContext());
+    engine.rootContext()->setContextObject(&model);
+
+    QSignalSpy spyInserted(&model, &QQmlListModel::rowsInserted);
+    QSignalSpy spyCount(&model, &QQmlListModel::countChanged);
+
+    QVariantList rows;
+    for (int i = 0; i < 100; ++i)
+        rows.append(QVariantMap { { "name", QString::number(i) }, { "value", double(i) } });
+
+    model.append(rows);
+    QCOMPARE(model.count(), 100);
+    QCOMPARE(spyInserted.size(), 1);
+    QCOMPARE(spyInserted.at(0).at(1).toInt(), 0);
+    QCOMPARE(spyInserted.at(0).at(2).toInt(), 99);
+    QCOMPARE(spyCount.size(), 1);
+
+    model.insert(50, QVariantList { QVariantMap { { "name", "a" } }, QVariantMap { { "name", "b" } } });
+    QCOMPARE(model.count(), 102);
+    QCOMPARE(spyInserted.size(), 2);
+    QCOMPARE(spyInserted.at(1).at(1).toInt(), 50);
+    QCOMPARE(spyInserted.at(1).at(2).toInt(), 51);
+
+    const int nameRole = roleFromName(&model, "name");
+    const int valueRole = roleFromName(&model, "value");
+    QCOMPARE(model.data(49, nameRole).toString(), QStringLiteral("49"));
+    QCOMPARE(model.data(50, nameRole).toString(), QStringLiteral("a"));
+    QCOMPARE(model.data(51, nameRole).toString(), QStringLiteral("b"));
+    QCOMPARE(model.data(52, nameRole).toString(), QStringLiteral("50"));
+    QCOMPARE(model.data(101, valueRole).toDouble(), 99.0);
+
+    // Objects handed out before a bulk insertion must keep tracking their row
+    QQmlExpression e(engine.rootContext(), &model,
+                     "var item = get(100);"
+                     "insert(0, [{ name: 'x' }, { name: 'y' }, { name: 'z' }]);"
+                     "item.name + ':' + get(0).name + get(1).name + get(2).name + ':' + get(103).name");
+    QCOMPARE(e.evaluate().toString(), QStringLiteral("98:xyz:98"));
+    QVERIFY(!e.hasError());
+    QCOMPARE(model.count(), 105);
+    QCOMPARE(spyInserted.size(), 3);
+}
+
+void tst_qqmllistmodel::batch()
+{
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("batch.qml"));
+    QVERIFY2(component.isReady(), qPrintable(component.errorString()));
+    QScopedPointer<QObject> root(component.create());
+    QVERIFY(!root.isNull());
+
+    QQmlListModel *model = qobject_cast<QQmlListModel *>(root->property("model").value<QObject *>());
+    QVERIFY(model);
+    const int nameRole = roleFromName(model, "name");
+    const int costRole = roleFromName(model, "cost");
+
+    QSignalSpy spyChanged(model, &QQmlListModel::dataChanged);
+    QSignalSpy spyInserted(model, &QQmlListModel::rowsInserted);
+    QSignalSpy spyCount(model, &QQmlListModel::countChanged);
+
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "updateCosts"));
+    QCOMPARE(spyChanged.size(), 1);
+    QCOMPARE(spyChanged.at(0).at(0).value<QModelIndex>().row(), 1);
+    QCOMPARE(spyChanged.at(0).at(1).value<QModelIndex>().row(), 3);
+    const QVector<int> roles = spyChanged.at(0).at(2).value<QVector<int>>();
+    QCOMPARE(roles.size(), 2);
+    QVERIFY(roles.contains(nameRole));
+    QVERIFY(roles.contains(costRole));
+    QCOMPARE(spyCount.size(), 0);
+    QCOMPARE(model->data(2, nameRole).toString(), QStringLiteral("c2"));
+    QCOMPARE(model->data(3, costRole).toInt(), 30);
+
+    // Structural changes report the changes collected so far first
+    spyChanged.clear();
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "updateAndAppend"));
+    QCOMPARE(spyChanged.size(), 2);
+    QCOMPARE(spyChanged.at(0).at(0).value<QModelIndex>().row(), 0);
+    QCOMPARE(spyChanged.at(0).at(1).value<QModelIndex>().row(), 0);
+    QCOMPARE(spyChanged.at(1).at(0).value<QModelIndex>().row(), 4);
+    QCOMPARE(spyChanged.at(1).at(1).value<QModelIndex>().row(), 4);
+    QCOMPARE(spyInserted.size(), 2);
+    QCOMPARE(spyCount.size(), 1);
+    QCOMPARE(model->count(), 7);
+
+    QTest::ignoreMessage(QtWarningMsg, QRegularExpression(".*endBatch: no batch in progress"));
+    QVERIFY(QMetaObject::invokeMethod(root.data(), "unbalancedEnd"));
+}
+
 QTEST_MAIN(tst_qqmllistmodel)
 
 #include "tst_qqmllistmodel.moc"
@@ -81,6 +81,8 @@ private slots:
     void dynamic_role_data();
     void dynamic_role();
     void correctMoves();
+    void worker_replace_data();
+    void worker_replace();
 };
 
 bool tst_qqmllistmodelworkerscript::compareVariantList(const QVariantList &testList, QVariant object)
@@ -835,6 +837,59 @@ void tst_qqmllistmodelworkerscript::correctMoves()
     QTRY_VERIFY(check());
 }
 
+void tst_qqmllistmodelworkerscript::worker_replace_data()
+{
+    QTest::addColumn<bool>("dynamicRoles");
+
+    QTest::newRow("staticRoles") << false;
+    QTest::newRow("dynamicRoles") << true;
+}
+
+void tst_qqmllistmodelworkerscript::worker_replace()
+{
+    QFETCH(bool, dynamicRoles);
+
+    // Populating a model from scratch in a worker is reported as a single change on sync()
+    QQmlEngine eng;
+    QQmlComponent component(&eng, testFileUrl("model.qml"));
+    const QVariantList commands { "clear()", "append([{name: 'a'}, {name: 'b'}, {name: 'c'}, {name: 'd'}])" };
+
+    for (const bool initiallyEmpty : { false, true }) {
+        QQmlListModel model;
+        model.setDynamicRoles(dynamicRoles);
+        if (!initiallyEmpty)
+            model.append(QVariantList { QVariantMap { { "name", "x" } }, QVariantMap { { "name", "y" } } });
+
+        QScopedPointer<QQuickItem> item(createWorkerTest(&eng, &component, &model));
+        QVERIFY(item);
+
+        QSignalSpy spyReset(&model, &QQmlListModel::modelReset);
+        QSignalSpy spyInserted(&model, &QQmlListModel::rowsInserted);
+        QSignalSpy spyRemoved(&model, &QQmlListModel::rowsRemoved);
+
+        QVERIFY(QMetaObject::invokeMethod(item.data(), "evalExpressionViaWorker",
+                                          Q_ARG(QVariant, commands)));
+        waitForWorker(item.data());
+
+        QCOMPARE(model.count(), 4);
+        QCOMPARE(spyRemoved.size(), 0);
+        if (initiallyEmpty) {
+            QCOMPARE(spyReset.size(), 0);
+            QCOMPARE(spyInserted.size(), 1);
+            QCOMPARE(spyInserted.at(0).at(1).toInt(), 0);
+            QCOMPARE(spyInserted.at(0).at(2).toInt(), 3);
+        } else {
+            QCOMPARE(spyReset.size(), 1);
+            QCOMPARE(spyInserted.size(), 0);
+        }
+
+        const int nameRole = model.roleNames().key("name", -1);
+        QVERIFY(nameRole != -1);
+        QCOMPARE(model.data(model.index(0, 0, QModelIndex()), nameRole).toString(), QStringLiteral("a"));
+        QCOMPARE(model.data(model.index(3, 0, QModelIndex()), nameRole).toString(), QStringLiteral("d"));
+    }
+}
+
 QTEST_MAIN(tst_qqmllistmodelworkerscript)
 
 #include "tst_qqmllistmodelworkerscript.moc"
@@ -3,6 +3,7 @@
 
 #include <QtTest/qtest.h>
 #include <QAbstractItemModelTester>
+#include <QStandardItemModel>
 
 #include <QtQmlModels/private/qqmltreemodeltotablemodel_p_p.h>
 
@@ -18,6 +19,8 @@ class tst_QQmlTreeModelToTableModel : public QObject {
 private slots:
     void testTestModel();
     void testTreeModelToTableModel();
+    void itemIndex();
+    void itemIndexAfterSourceChanges();
 };
 
 void tst_QQmlTreeModelToTableModel::testTestModel()
@@ -34,6 +37,144 @@ void tst_QQmlTreeModelToTableModel::testTreeModelToTableModel()
     QAbstractItemModelTester tester(&model, QAbstractItemModelTester::FailureReportingMode::QtTest);
 }
 
+// Two levels of rows, with all second level rows being children of top level ones.
+class WideTreeModel : public QAbstractItemModel
+{
+public:
+    WideTreeModel(int topLevelCount, int childCount)
+        : m_topLevelCount(topLevelCount), m_childCount(childCount)
+    {}
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override
+    {
+        if (!hasIndex(row, column, parent))
+            return QModelIndex();
+        return createIndex(row, column, parent.isValid() ? quintptr(parent.row() + 1) : 0);
+    }
+
+    QModelIndex parent(const QModelIndex &child) const override
+    {
+        if (!child.isValid() || child.internalId() == 0)
+            return QModelIndex();
+        return createIndex(int(child.internalId() - 1), 0, quintptr(0));
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        if (!parent.isValid())
+            return m_topLevelCount;
+        return (parent.internalId() == 0 && parent.column() == 0) ? m_childCount : 0;
+    }
+
+    int columnCount(const QModelIndex & = QModelIndex()) const override { return 1; }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        return index.row();
+    }
+
+private:
+    int m_topLevelCount;
+    int m_childCount;
+};
+
+void tst_QQmlTreeModelToTableModel::itemIndex()
+{
+    QQmlTreeModelToTableModel model;
+    WideTreeModel treeModel(40, 100);
+    model.setModel(&treeModel);
+
+    for (int row = treeModel.rowCount() - 1; row >= 0; --row)
+        model.expandRow(row);
+    QCOMPARE(model.rowCount(), 40 * 101);
+
+    // Look rows up far apart from each other, so that the lookup can't just scan nearby rows.
+    const auto verifyRows = [&]() {
+        const int count = model.rowCount();
+        for (int i = 0; i < count; ++i) {
+            const int row = int((qint64(i) * 7919) % count);
+            const QModelIndex index = model.mapToModel(row);
+            QCOMPARE(model.itemIndex(index), row);
+            QCOMPARE(model.mapFromModel(index).row(), row);
+        }
+        QVERIFY(model.testConsistency());
+    };
+    verifyRows();
+
+    const QModelIndex collapsedParent = treeModel.index(7, 0);
+    const QModelIndex hiddenChild = treeModel.index(50, 0, collapsedParent);
+    QCOMPARE(model.itemIndex(hiddenChild), 7 * 101 + 1 + 50);
+
+    model.collapse(collapsedParent);
+    model.collapse(treeModel.index(30, 0));
+    QCOMPARE(model.rowCount(), 38 * 101 + 2);
+    QCOMPARE(model.itemIndex(hiddenChild), -1);
+    verifyRows();
+
+    model.expand(collapsedParent);
+    QCOMPARE(model.itemIndex(hiddenChild), 7 * 101 + 1 + 50);
+    verifyRows();
+}
+
+void tst_QQmlTreeModelToTableModel::itemIndexAfterSourceChanges()
+{
+    QStandardItemModel treeModel;
+    for (int i = 0; i < 40; ++i) {
+        QStandardItem *parentItem = new QStandardItem(QString::number(i));
+        for (int j = 0; j < 100; ++j)
+            parentItem->appendRow(new QStandardItem(QString::number(j)));
+        treeModel.appendRow(parentItem);
+    }
+
+    QQmlTreeModelToTableModel model;
+    model.setModel(&treeModel);
+    for (int row = treeModel.rowCount() - 1; row >= 0; --row)
+        model.expandRow(row);
+
+    // Looking up rows far apart from each other builds the item index cache.
+    const int count = model.rowCount();
+    for (int i = 0; i < count; ++i) {
+        const int row = int((qint64(i) * 7919) % count);
+        QCOMPARE(model.itemIndex(model.mapToModel(row)), row);
+    }
+
+    const auto verifyChildren = [&](const QModelIndex &parent) {
+        const int parentRow = model.itemIndex(parent);
+        QVERIFY(parentRow != -1);
+        for (int i = 0; i < treeModel.rowCount(parent); ++i) {
+            const QModelIndex child = treeModel.index(i, 0, parent);
+            QVERIFY(model.isVisible(child));
+            QCOMPARE(model.mapFromModel(child).row(), parentRow + 1 + i);
+        }
+        QVERIFY(model.testConsistency());
+    };
+
+    // Rows inserted in the middle of an expanded parent move the siblings after them.
+    QStandardItem *parentItem = treeModel.item(20);
+    QList<QStandardItem *> newItems;
+    for (int i = 0; i < 3; ++i)
+        newItems.append(new QStandardItem(QStringLiteral("new")));
+    parentItem->insertRows(50, newItems);
+    verifyChildren(parentItem->index());
+
+    parentItem->removeRows(10, 5);
+    verifyChildren(parentItem->index());
+
+    // The same for top level rows.
+    treeModel.removeRows(5, 2);
+    treeModel.insertRow(15, new QStandardItem(QStringLiteral("new")));
+    int expectedRow = 0;
+    for (int i = 0; i < treeModel.rowCount(); ++i) {
+        const QModelIndex index = treeModel.index(i, 0);
+        QCOMPARE(model.mapFromModel(index).row(), expectedRow);
+        expectedRow += 1 + (model.isExpanded(index) ? treeModel.rowCount(index) : 0);
+    }
+    QCOMPARE(expectedRow, model.rowCount());
+    verifyChildren(treeModel.index(30, 0));
+}
+
 QTEST_MAIN(tst_QQmlTreeModelToTableModel)
 
 #include "tst_qqmltreemodeltotablemodel.moc"
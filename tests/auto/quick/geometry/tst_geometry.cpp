@@ -16,6 +16,7 @@ private Q_SLOTS:
     void testPoint2D();
     void testTexturedPoint2D();
     void testCustomGeometry();
+    void testReallocate();
 
 private:
 };
@@ -137,6 +138,46 @@ void GeometryTest::testCustomGeometry()
 
 }
 
+void GeometryTest::testReallocate()
+{
+    QSGGeometry geometry(QSGGeometry::defaultAttributes_Point2D(), 10, 12);
+
+    // Growing a little keeps the same block
+    const void *data = geometry.vertexData();
+    geometry.allocate(11, 12);
+    QCOMPARE(geometry.vertexData(), data);
+    QCOMPARE(geometry.indexData(), (const void *) (geometry.vertexDataAsPoint2D() + 11));
+
+    // Growing a lot gives enough space for the vertices and the indices
+    geometry.allocate(1000, 1500);
+    QSGGeometry::Point2D *pts = geometry.vertexDataAsPoint2D();
+    quint16 *is = geometry.indexDataAsUShort();
+    QCOMPARE((const void *) is, (const void *) (pts + 1000));
+    for (int i = 0; i < 1000; ++i) {
+        pts[i].x = i;
+        pts[i].y = -i;
+    }
+    for (int i = 0; i < 1500; ++i)
+        is[i] = i;
+    for (int i = 0; i < 1000; ++i)
+        QCOMPARE(pts[i].y, float(-i));
+
+    // Small geometry without indices goes back to the inline storage, and
+    // geometry of a different size after that gets its own block again.
+    geometry.allocate(4, 0);
+    QVERIFY(!geometry.indexData());
+    QSGGeometry::updateRectGeometry(&geometry, QRectF(1, 2, 3, 4));
+    QCOMPARE(geometry.vertexDataAsPoint2D()[3].x, float(4));
+    geometry.allocate(100, 10);
+    pts = geometry.vertexDataAsPoint2D();
+    is = geometry.indexDataAsUShort();
+    for (int i = 0; i < 100; ++i)
+        pts[i].x = i;
+    for (int i = 0; i < 10; ++i)
+        is[i] = i;
+    QCOMPARE(is[9], quint16(9));
+}
+
 
 QTEST_MAIN(GeometryTest);
 
@@ -273,6 +273,7 @@ private slots:
 
     void reuse_reuseIsOffByDefault();
     void reuse_checkThatItemsAreReused();
+    void reuse_poolLimit();
     void moveObjectModelItemToAnotherObjectModel();
     void changeModelAndDestroyTheOldOne();
     void objectModelCulling();
@@ -9937,6 +9938,65 @@ void tst_QQuickListView::reuse_checkThatItemsAreReused()
     }
 }
 
+void tst_QQuickListView::reuse_poolLimit()
+{
+    // Check that the reuse pool never holds more items than QML_DELEGATE_POOL_LIMIT,
+    // and that items released into a full pool are destroyed instead of pooled.
+    const int poolLimit = 5;
+    qputenv("QML_DELEGATE_POOL_LIMIT", QByteArray::number(poolLimit));
+    const auto unsetLimit = qScopeGuard([] { qunsetenv("QML_DELEGATE_POOL_LIMIT"); });
+
+    QScopedPointer<QQuickView> window(createView());
+
+    ReuseModel model(100);
+    QQmlContext *ctxt = window->rootContext();
+    ctxt->setContextProperty("reuseModel", &model);
+
+    window->setSource(testFileUrl("reusedelegateitems.qml"));
+    window->resize(640, 480);
+    window->show();
+    QVERIFY(QTest::qWaitForWindowExposed(window.data()));
+    QVERIFY(window->rootObject() != nullptr);
+
+    QQuickListView *listView = findItem<QQuickListView>(window->rootObject(), "list");
+    QTRY_VERIFY(listView != nullptr);
+    const auto itemView_d = QQuickItemViewPrivate::get(listView);
+
+    auto items = findItems<QQuickItem>(listView, "delegate");
+    const int initialItemCount = items.size();
+    QVERIFY(initialItemCount > poolLimit + 1);
+
+    // Flick one page down. All initial items except ListView.currentItem are
+    // released, but only poolLimit of them fit into the pool.
+    const qreal delegateHeight = items.at(0)->height();
+    const qreal flickDistance = (initialItemCount * delegateHeight) + 1;
+    listView->setContentY(flickDistance);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    const int countAfterDownFlick = listView->property("delegatesCreatedCount").toInt();
+    QCOMPARE(countAfterDownFlick, initialItemCount * 2);
+    QCOMPARE(itemView_d->model->poolSize(), poolLimit);
+
+    // Flick one page up. Only the pooled items can be reused, the rest of
+    // the page needs to be created again.
+    listView->setContentY(0);
+    QVERIFY(QQuickTest::qWaitForPolish(listView));
+    const int countAfterUpFlick = listView->property("delegatesCreatedCount").toInt();
+    QCOMPARE(countAfterUpFlick, countAfterDownFlick + (initialItemCount - 1 - poolLimit));
+    QCOMPARE(itemView_d->model->poolSize(), poolLimit);
+
+    int reusedItemCount = 0;
+    items = findItems<QQuickItem>(listView, "delegate");
+    for (const auto item : std::as_const(items)) {
+        const int reusedCount = item->property("reusedCount").toInt();
+        QVERIFY(reusedCount <= 1);
+        if (reusedCount == 1) {
+            QCOMPARE(item->property("pooledCount").toInt(), 1);
+            ++reusedItemCount;
+        }
+    }
+    QCOMPARE(reusedItemCount, poolLimit);
+}
+
 void tst_QQuickListView::dragOverFloatingHeaderOrFooter() // QTBUG-74046
 {
     QQuickView *window = getView();
@@ -0,0 +1,28 @@
+import QtQuick
+import QtQml.Models
+
+Item {
+    width: 400; height: 400
+
+    property string completionOrder
+
+    function load() {
+        instantiator.active = true
+        loader.source = "BigComponent.qml"
+    }
+
+    Instantiator {
+        id: instantiator
+        active: false
+        asynchronous: true
+        delegate: QtObject {}
+        onObjectAdded: completionOrder += "instantiator;"
+    }
+
+    Loader {
+        id: loader
+        objectName: "loader"
+        asynchronous: true
+        onLoaded: completionOrder += "loader;"
+    }
+}
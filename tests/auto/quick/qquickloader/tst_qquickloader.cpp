@@ -85,6 +85,7 @@ private slots:
     void asynchronous_data();
     void asynchronous();
     void asynchronous_clear();
+    void asynchronousInstantiator();
     void simultaneousSyncAsync();
     void asyncToSync1();
     void asyncToSync2();
@@ -986,6 +987,36 @@ void tst_QQuickLoader::asynchronous_clear()
     QCOMPARE(static_cast<QQuickItem*>(loader)->childItems().size(), 1);
 }
 
+void tst_QQuickLoader::asynchronousInstantiator()
+{
+    // Check that an asynchronous Instantiator is incubated at normal priority,
+    // and not held up by a visible Loader that was queued after it.
+    QQmlEngine engine;
+    PeriodicIncubationController *controller = new PeriodicIncubationController;
+    QQmlIncubationController *previous = engine.incubationController();
+    engine.setIncubationController(controller);
+    delete previous;
+
+    QQmlComponent component(&engine, testFileUrl("asynchronousInstantiator.qml"));
+    QScopedPointer<QQuickItem> root(qobject_cast<QQuickItem*>(component.create()));
+    QVERIFY(root);
+
+    QQuickLoader *loader = root->findChild<QQuickLoader*>("loader");
+    QVERIFY(loader);
+
+    QMetaObject::invokeMethod(root.data(), "load");
+    QTRY_COMPARE(controller->incubatingObjectCount(), 2);
+    QCOMPARE(loader->status(), QQuickLoader::Loading);
+
+    while (controller->incubatingObjectCount() > 0) {
+        std::atomic<bool> b{false};
+        controller->incubateWhile(&b);
+    }
+
+    QVERIFY(loader->item());
+    QCOMPARE(root->property("completionOrder").toString(), QStringLiteral("instantiator;loader;"));
+}
+
 void tst_QQuickLoader::simultaneousSyncAsync()
 {
     QQmlEngine engine;
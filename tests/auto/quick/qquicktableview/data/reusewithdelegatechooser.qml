@@ -0,0 +1,61 @@
+// Copyright (C) 2024 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+import QtQuick
+import Qt.labs.qmlmodels
+
+Item {
+    width: 640
+    height: 450
+
+    property alias tableView: tableView
+    property int delegatesCreatedCount: 0
+
+    TableView {
+        id: tableView
+        width: 600
+        height: 400
+        clip: true
+        delegate: DelegateChooser {
+            DelegateChoice {
+                column: 0
+                delegate: firstColumnDelegate
+            }
+            DelegateChoice {
+                delegate: tableViewDelegate
+            }
+        }
+    }
+
+    Component {
+        id: firstColumnDelegate
+        Rectangle {
+            objectName: "firstColumnDelegate"
+            implicitWidth: 100
+            implicitHeight: 50
+            color: "green"
+
+            property int pooledCount: 0
+            property int reusedCount: 0
+            TableView.onPooled: pooledCount++;
+            TableView.onReused: reusedCount++;
+            Component.onCompleted: delegatesCreatedCount++
+        }
+    }
+
+    Component {
+        id: tableViewDelegate
+        Rectangle {
+            objectName: "tableViewDelegate"
+            implicitWidth: 100
+            implicitHeight: 50
+            color: "lightgray"
+
+            property int pooledCount: 0
+            property int reusedCount: 0
+            TableView.onPooled: pooledCount++;
+            TableView.onReused: reusedCount++;
+            Component.onCompleted: delegatesCreatedCount++
+        }
+    }
+}
@@ -0,0 +1,44 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR LGPL-3.0-only OR GPL-2.0-only OR GPL-3.0-only
+
+import QtQuick
+
+Item {
+    width: 640
+    height: 450
+
+    property alias tableView: tableView
+
+    function removeRows(row, count) {
+        listModel.remove(row, count)
+    }
+
+    function appendRows(count) {
+        for (let i = 0; i < count; ++i)
+            listModel.append({ rowHeight: 20 })
+    }
+
+    ListModel {
+        id: listModel
+        Component.onCompleted: {
+            // The first 20 rows are tall, the rest are short
+            for (let i = 0; i < 100; ++i)
+                append({ rowHeight: i < 20 ? 100 : 20 })
+        }
+    }
+
+    TableView {
+        id: tableView
+        width: 600
+        height: 400
+        clip: true
+        rowSpacing: 1
+        model: listModel
+        delegate: Rectangle {
+            required property real rowHeight
+            implicitWidth: 100
+            implicitHeight: rowHeight
+            color: "lightgray"
+        }
+    }
+}
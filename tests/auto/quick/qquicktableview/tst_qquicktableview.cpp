@@ -125,6 +125,8 @@ private slots:
     void checkDelegateParent();
     void flick_data();
     void flick();
+    void prefetchWhileFlicking();
+    void visibleEdgesWhilePrefetching();
     void flickOvershoot_data();
     void flickOvershoot();
     void checkRowColumnCount();
@@ -135,6 +137,8 @@ private slots:
     void checkIfDelegatesAreReused_data();
     void checkIfDelegatesAreReused();
     void checkIfDelegatesAreReusedAsymmetricTableSize();
+    void checkIfDelegatesAreReusedWithPoolLimit();
+    void checkIfDelegatesAreReusedPerDelegateComponent();
     void checkContextProperties_data();
     void checkContextProperties();
     void checkContextPropertiesQQmlListProperyModel_data();
@@ -174,6 +178,9 @@ private slots:
     void positionViewAtColumnClamped_data();
     void positionViewAtColumnClamped();
     void positionViewAtCellWithAnimation();
+    void positionViewAtRowWithVariableRowHeights();
+    void positionViewAtRowAfterRemovingRows();
+    void positionViewAtRowAfterAppendingRows();
     void positionViewAtCell_VisibleAndContain_data();
     void positionViewAtCell_VisibleAndContain();
     void positionViewAtCell_VisibleAndContain_SubRect_data();
@@ -1577,6 +1584,73 @@ void tst_QQuickTableView::flick()
     }
 }
 
+void tst_QQuickTableView::prefetchWhileFlicking()
+{
+    // Check that while flicking, the table loads rows ahead of the viewport in
+    // the direction of the flick, and unloads them again once the flick ends.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    auto model = TestModelAsVariant(1000, 4);
+    tableView->setModel(model);
+    tableView->setMaximumFlickVelocity(20000);
+    tableView->setFlickDeceleration(1000);
+
+    WAIT_UNTIL_POLISHED;
+
+    QVERIFY(tableViewPrivate->averageCellLoadTime > 0);
+    QVERIFY(tableViewPrivate->loadedTableInnerRect.bottom() < tableViewPrivate->viewportRect.bottom());
+
+    tableView->flick(0, -20000);
+    QVERIFY(tableView->isMoving());
+
+    // A row that lies completely below the viewport is only loaded when prefetching
+    QTRY_VERIFY(tableViewPrivate->loadedTableInnerRect.bottom() >= tableViewPrivate->viewportRect.bottom());
+
+    tableView->cancelFlick();
+    QTRY_VERIFY(!tableView->isMoving());
+    QTRY_VERIFY(tableViewPrivate->loadedTableInnerRect.bottom() < tableViewPrivate->viewportRect.bottom());
+}
+
+void tst_QQuickTableView::visibleEdgesWhilePrefetching()
+{
+    // Check that rows that are prefetched while flicking are not
+    // reported by topRow and bottomRow before they are inside the viewport.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    auto model = TestModelAsVariant(1000, 4);
+    tableView->setModel(model);
+    tableView->setMaximumFlickVelocity(20000);
+    tableView->setFlickDeceleration(1000);
+
+    WAIT_UNTIL_POLISHED;
+
+    bool outsideViewport = false;
+    auto checkVisibleRows = [&] {
+        const QRectF viewportRect = tableViewPrivate->viewportRect;
+        const int topRow = tableView->topRow();
+        const int bottomRow = tableView->bottomRow();
+        if (tableViewPrivate->getEffectiveRowY(topRow) + tableViewPrivate->getEffectiveRowHeight(topRow) <= viewportRect.top())
+            outsideViewport = true;
+        if (tableViewPrivate->getEffectiveRowY(bottomRow) >= viewportRect.bottom())
+            outsideViewport = true;
+    };
+    connect(tableView, &QQuickTableView::topRowChanged, checkVisibleRows);
+    connect(tableView, &QQuickTableView::bottomRowChanged, checkVisibleRows);
+
+    tableView->flick(0, -20000);
+    QVERIFY(tableView->isMoving());
+
+    QTRY_VERIFY(tableViewPrivate->loadedTableInnerRect.bottom() >= tableViewPrivate->viewportRect.bottom());
+    QVERIFY(tableView->bottomRow() < tableViewPrivate->bottomRow());
+    checkVisibleRows();
+    QVERIFY(!outsideViewport);
+
+    tableView->cancelFlick();
+    QTRY_VERIFY(!tableView->isMoving());
+    checkVisibleRows();
+    QVERIFY(!outsideViewport);
+}
+
 void tst_QQuickTableView::flickOvershoot_data()
 {
     QTest::addColumn<QSizeF>("spacing");
@@ -2112,6 +2186,85 @@ void tst_QQuickTableView::checkIfDelegatesAreReusedAsymmetricTableSize()
     QCOMPARE(tableViewPrivate->tableModel->poolSize(), 0);
 }
 
+void tst_QQuickTableView::checkIfDelegatesAreReusedWithPoolLimit()
+{
+    // Check that the pool never holds more items than QML_DELEGATE_POOL_LIMIT, and
+    // that the items that don't fit into the pool are destroyed instead of pooled.
+    const int poolLimit = 3;
+    qputenv("QML_DELEGATE_POOL_LIMIT", QByteArray::number(poolLimit));
+    const auto unsetLimit = qScopeGuard([] { qunsetenv("QML_DELEGATE_POOL_LIMIT"); });
+
+    LOAD_TABLEVIEW("countingtableview.qml");
+
+    auto model = TestModelAsVariant(100, 100);
+    tableView->setModel(model);
+
+    WAIT_UNTIL_POLISHED;
+
+    const int columnCount = tableViewPrivate->loadedColumns.count();
+    QVERIFY(columnCount > poolLimit);
+    const int delegateCountAfterInit = view->rootObject()->property(kDelegatesCreatedCountProp).toInt();
+    const qreal delegateHeight = tableViewPrivate->loadedTableItem(QPoint(0, 0))->item->height();
+
+    // Flick exactly one row out at the top, and one row in at the bottom. The row at the top
+    // is unloaded first, but only poolLimit of its items fit into the pool and can be
+    // reused by the new row. The rest of the new row needs to be created from the delegate.
+    tableView->setContentY(delegateHeight);
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    QCOMPARE(tableViewPrivate->loadedColumns.count(), columnCount);
+    QCOMPARE(view->rootObject()->property(kDelegatesCreatedCountProp).toInt(),
+             delegateCountAfterInit + columnCount - poolLimit);
+    QVERIFY(tableViewPrivate->tableModel->poolSize() <= poolLimit);
+
+    int reusedItemCount = 0;
+    for (auto fxItem : tableViewPrivate->loadedItems) {
+        const int reusedCount = fxItem->item->property("reusedCount").toInt();
+        QVERIFY(reusedCount <= 1);
+        if (reusedCount == 1) {
+            QCOMPARE(fxItem->item->property("pooledCount").toInt(), 1);
+            ++reusedItemCount;
+        }
+    }
+    QCOMPARE(reusedItemCount, poolLimit);
+
+    // The items that didn't fit into the pool were destroyed
+    QTRY_COMPARE(view->rootObject()->property("currentDelegateCount").toInt(),
+                 tableViewPrivate->loadedItems.count() + tableViewPrivate->tableModel->poolSize());
+}
+
+void tst_QQuickTableView::checkIfDelegatesAreReusedPerDelegateComponent()
+{
+    // Check that when using several delegate components, a pooled
+    // item is only reused for a cell that uses the same component.
+    LOAD_TABLEVIEW("reusewithdelegatechooser.qml");
+
+    auto model = TestModelAsVariant(100, 100);
+    tableView->setModel(model);
+
+    WAIT_UNTIL_POLISHED;
+
+    const int delegateCountAfterInit = view->rootObject()->property(kDelegatesCreatedCountProp).toInt();
+    const qreal delegateHeight = tableViewPrivate->loadedTableItem(QPoint(0, 0))->item->height();
+
+    // Flick exactly one row out at the top, and one row in at the bottom
+    tableView->setContentY(delegateHeight);
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    // All items in the new row should be reused, and none should be created
+    QCOMPARE(view->rootObject()->property(kDelegatesCreatedCountProp).toInt(), delegateCountAfterInit);
+    QCOMPARE(tableViewPrivate->tableModel->poolSize(), 0);
+
+    const int newRow = tableView->bottomRow();
+    for (int column = tableView->leftColumn(); column <= tableView->rightColumn(); ++column) {
+        const auto item = tableView->itemAtCell(QPoint(column, newRow));
+        QVERIFY(item);
+        QCOMPARE(item->objectName(), column == 0 ? "firstColumnDelegate" : "tableViewDelegate");
+        QCOMPARE(item->property("pooledCount").toInt(), 1);
+        QCOMPARE(item->property("reusedCount").toInt(), 1);
+    }
+}
+
 void tst_QQuickTableView::checkContextProperties_data()
 {
     QTest::addColumn<QVariant>("model");
@@ -3658,6 +3811,107 @@ void tst_QQuickTableView::positionViewAtCellWithAnimation()
     QCOMPARE(cellGeometry.bottom(), expectedPos.y());
 }
 
+void tst_QQuickTableView::positionViewAtRowWithVariableRowHeights()
+{
+    // Check that when the rows have different heights, positioning the view at a row
+    // (or moving the viewport far away) places the rows according to their recorded
+    // heights, and not only according to the average height of the loaded rows.
+    LOAD_TABLEVIEW("plaintableview.qml");
+
+    const qreal spacing = tableView->rowSpacing();
+    for (int row = 0; row < 10; ++row)
+        tableView->setRowHeight(row, 10);
+    for (int row = 10; row < 100; ++row)
+        tableView->setRowHeight(row, 100);
+
+    auto model = TestModelAsVariant(1000, 4);
+    tableView->setModel(model);
+
+    WAIT_UNTIL_POLISHED;
+
+    const qreal row55Y = (10 * (10 + spacing)) + (45 * (100 + spacing));
+    const qreal row100Y = (10 * (10 + spacing)) + (90 * (100 + spacing));
+
+    tableView->positionViewAtRow(100, QQuickTableView::AlignTop);
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->topRow(), 100);
+    QCOMPARE(tableView->contentY(), row100Y);
+    QCOMPARE(tableViewPrivate->loadedTableItem(QPoint(0, 100))->geometry().y(), row100Y);
+
+    // Move the viewport far enough for the table to be rebuilt
+    // around a guesstimated top-left row
+    tableView->setContentY(row55Y);
+    WAIT_UNTIL_POLISHED;
+
+    QCOMPARE(tableView->topRow(), 55);
+    QCOMPARE(tableViewPrivate->loadedTableItem(QPoint(0, 55))->geometry().y(), row55Y);
+}
+
+void tst_QQuickTableView::positionViewAtRowAfterRemovingRows()
+{
+    // Check that the heights recorded for the rows that have been laid out
+    // follow the rows when the model removes rows in front of them.
+    LOAD_TABLEVIEW("variablerowheights.qml");
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    // Scroll through the first 50 rows, so that all of them get measured
+    for (int contentY = 100; contentY <= 2400; contentY += 100) {
+        tableView->setContentY(contentY);
+        QVERIFY(QQuickTest::qWaitForPolish(tableView));
+    }
+    QVERIFY(tableView->bottomRow() >= 50);
+    tableView->setContentY(0);
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    // Remove five of the tall rows, which leaves 15 tall rows at the top
+    QVERIFY(QMetaObject::invokeMethod(view->rootObject(), "removeRows", Q_ARG(QVariant, 0), Q_ARG(QVariant, 5)));
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+    QCOMPARE(tableView->rows(), 95);
+
+    const qreal spacing = tableView->rowSpacing();
+    const qreal row30Y = (15 * (100 + spacing)) + (15 * (20 + spacing));
+
+    tableView->positionViewAtRow(30, QQuickTableView::AlignTop);
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    QCOMPARE(tableView->topRow(), 30);
+    QCOMPARE(tableView->contentY(), row30Y);
+    QCOMPARE(tableViewPrivate->loadedTableItem(QPoint(0, 30))->geometry().y(), row30Y);
+}
+
+void tst_QQuickTableView::positionViewAtRowAfterAppendingRows()
+{
+    // Check that the heights recorded for the rows that have been laid
+    // out are kept when the model appends rows at the end of the table.
+    LOAD_TABLEVIEW("variablerowheights.qml");
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    // Scroll through the first 50 rows, so that all of them get measured
+    for (int contentY = 100; contentY <= 2400; contentY += 100) {
+        tableView->setContentY(contentY);
+        QVERIFY(QQuickTest::qWaitForPolish(tableView));
+    }
+    QVERIFY(tableView->bottomRow() >= 50);
+    tableView->setContentY(0);
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    // Append the rows one by one, as that is how a model would typically grow
+    QVERIFY(QMetaObject::invokeMethod(view->rootObject(), "appendRows", Q_ARG(QVariant, 100)));
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+    QCOMPARE(tableView->rows(), 200);
+
+    const qreal spacing = tableView->rowSpacing();
+    const qreal row30Y = (20 * (100 + spacing)) + (10 * (20 + spacing));
+
+    tableView->positionViewAtRow(30, QQuickTableView::AlignTop);
+    QVERIFY(QQuickTest::qWaitForPolish(tableView));
+
+    QCOMPARE(tableView->topRow(), 30);
+    QCOMPARE(tableView->contentY(), row30Y);
+    QCOMPARE(tableViewPrivate->loadedTableItem(QPoint(0, 30))->geometry().y(), row30Y);
+}
+
 void tst_QQuickTableView::positionViewAtCell_VisibleAndContain_data()
 {
     QTest::addColumn<QPoint>("cell");
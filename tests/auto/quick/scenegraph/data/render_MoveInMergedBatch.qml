@@ -0,0 +1,65 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick 2.2
+
+/*
+    This test verifies that moving one item in a merged batch, which
+    only uploads the vertices of that item again, renders it at its new
+    position while the other items in the batch stay where they are.
+
+    #samples: 8
+                 PixelPos     R    G    B    Error-tolerance
+    #base:        20  20     1.0  0.0  0.0       0.0
+    #base:        70  20     0.0  1.0  0.0       0.0
+    #base:       120  20     0.0  0.0  1.0       0.0
+    #base:        70 120     0.0  0.0  0.0       0.0
+    #final:       20  20     1.0  0.0  0.0       0.0
+    #final:       70  20     0.0  0.0  0.0       0.0
+    #final:      120  20     0.0  0.0  1.0       0.0
+    #final:       70 120     0.0  1.0  0.0       0.0
+*/
+
+RenderTestBase {
+    id: root
+
+    Rectangle {
+        anchors.fill: parent
+        color: "black"
+    }
+
+    Rectangle {
+        x: 0
+        y: 0
+        width: 40
+        height: 40
+        color: "#ff0000"
+    }
+
+    Rectangle {
+        id: moving
+        x: 50
+        y: 0
+        width: 40
+        height: 40
+        color: "#00ff00"
+    }
+
+    Rectangle {
+        x: 100
+        y: 0
+        width: 40
+        height: 40
+        color: "#0000ff"
+    }
+
+    SequentialAnimation {
+        id: animation
+        NumberAnimation { target: moving; property: "y"; from: 0; to: 100; duration: 100 }
+        PropertyAction { target: root; property: "finalStageComplete"; value: true; }
+    }
+
+    onEnterFinalStage: {
+        animation.running = true;
+    }
+}
@@ -0,0 +1,60 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick 2.2
+
+/*
+    The test verifies that batching does not interfere with overlapping
+    regions when there are enough semi-transparent elements between two
+    mergeable ones for the renderer to use its overlap grid.
+
+    The red rectangles could all be merged into one batch, but the last
+    one is on top of a blue rectangle and must be rendered after it.
+
+    #samples: 4
+                 PixelPos     R    G    B    Error-tolerance
+    #base:         4   4     0.5  0.0  0.0        0.05
+    #base:        14   4     0.0  0.0  0.6        0.05
+    #final:      105 105     0.0  0.0  0.6        0.05
+    #final:      120 120     0.5  0.0  0.3        0.05
+*/
+
+RenderTestBase
+{
+    Rectangle {
+        anchors.fill: parent
+        color: "black"
+    }
+
+    Repeater {
+        model: 40
+        Rectangle {
+            x: (index % 20) * 10
+            y: Math.floor(index / 20) * 10
+            width: 8
+            height: 8
+            color: index % 2 ? "blue" : "red"
+            opacity: index % 2 ? 0.6 : 0.5
+        }
+    }
+
+    Rectangle {
+        x: 100
+        y: 100
+        width: 40
+        height: 40
+        color: "blue"
+        opacity: 0.6
+    }
+
+    Rectangle {
+        x: 110
+        y: 110
+        width: 20
+        height: 20
+        color: "red"
+        opacity: 0.5
+    }
+
+    finalStageComplete: true
+}
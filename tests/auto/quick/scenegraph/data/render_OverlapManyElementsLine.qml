@@ -0,0 +1,68 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick 2.2
+import SceneGraphTest 1.0
+
+/*
+    The test verifies that the overlap grid, which the renderer uses when
+    there are many semi-transparent elements between two mergeable ones,
+    finds overlaps with elements whose bounds have no height.
+
+    The two red lines could be merged into one batch, but the second one
+    is on top of a blue rectangle and must be rendered after it.
+
+    #samples: 4
+                 PixelPos     R    G    B    Error-tolerance
+    #base:        50   0     0.5  0.0  0.0        0.05
+    #base:        14  14     0.0  0.0  0.6        0.05
+    #final:       95  60     0.5  0.0  0.0        0.05
+    #final:      120  60     0.5  0.0  0.3        0.05
+*/
+
+RenderTestBase
+{
+    Rectangle {
+        anchors.fill: parent
+        color: "black"
+    }
+
+    HorizontalLine {
+        x: 0
+        y: 0
+        width: 200
+        height: 1
+        color: "#80ff0000"
+    }
+
+    Repeater {
+        model: 40
+        Rectangle {
+            x: (index % 20) * 10
+            y: 10 + Math.floor(index / 20) * 10
+            width: 8
+            height: 8
+            color: index % 2 ? "blue" : "red"
+            opacity: index % 2 ? 0.6 : 0.5
+        }
+    }
+
+    Rectangle {
+        x: 100
+        y: 50
+        width: 40
+        height: 20
+        color: "blue"
+        opacity: 0.6
+    }
+
+    HorizontalLine {
+        x: 90
+        y: 60
+        width: 60
+        height: 1
+        color: "#80ff0000"
+    }
+
+    finalStageComplete: true
+}
@@ -0,0 +1,55 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick 2.2
+
+/*
+    This test verifies that rotated, antialiased rectangles, which are
+    rendered in an unmerged batch, are drawn at their own positions when
+    they share the vertices of the previous rectangle, and also after one
+    of them stops doing so.
+
+    #samples: 8
+                 PixelPos     R    G    B    Error-tolerance
+    #base:        30  30     1.0  0.0  0.0       0.0
+    #base:        90  30     1.0  0.0  0.0       0.0
+    #base:       150  30     1.0  0.0  0.0       0.0
+    #base:        11  11     0.0  0.0  0.0       0.0
+    #final:       30  30     1.0  0.0  0.0       0.0
+    #final:       90  30     0.0  1.0  0.0       0.0
+    #final:      150  30     1.0  0.0  0.0       0.0
+    #final:       11  11     0.0  0.0  0.0       0.0
+*/
+
+RenderTestBase {
+    id: root
+
+    Rectangle {
+        anchors.fill: parent
+        color: "black"
+    }
+
+    Repeater {
+        id: repeater
+        model: 3
+        Rectangle {
+            x: 10 + index * 60
+            y: 10
+            width: 40
+            height: 40
+            rotation: 45
+            antialiasing: true
+            color: "#ff0000"
+        }
+    }
+
+    SequentialAnimation {
+        id: animation
+        PropertyAction { target: repeater.itemAt(1); property: "color"; value: "#00ff00" }
+        PropertyAction { target: root; property: "finalStageComplete"; value: true; }
+    }
+
+    onEnterFinalStage: {
+        animation.running = true;
+    }
+}
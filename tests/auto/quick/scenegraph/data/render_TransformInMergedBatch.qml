@@ -0,0 +1,65 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick 2.2
+
+/*
+    This test verifies that giving one item in a merged batch a transform
+    the batch cannot be merged with, here a projective one, renders the
+    item with that transform instead of only uploading its vertices again.
+    The transform halves the item's coordinates, moving it to 50,0 - 70,20.
+
+    #samples: 7
+                 PixelPos     R    G    B    Error-tolerance
+    #base:        20  20     1.0  0.0  0.0       0.0
+    #base:        70  20     0.0  1.0  0.0       0.0
+    #base:       120  20     0.0  0.0  1.0       0.0
+    #final:       20  20     1.0  0.0  0.0       0.0
+    #final:       60  10     0.0  1.0  0.0       0.0
+    #final:       80  30     0.0  0.0  0.0       0.0
+    #final:      120  20     0.0  0.0  1.0       0.0
+*/
+
+RenderTestBase {
+    id: root
+
+    Rectangle {
+        anchors.fill: parent
+        color: "black"
+    }
+
+    Rectangle {
+        x: 0
+        y: 0
+        width: 40
+        height: 40
+        color: "#ff0000"
+    }
+
+    Rectangle {
+        x: 50
+        y: 0
+        width: 40
+        height: 40
+        color: "#00ff00"
+        transform: Matrix4x4 {
+            id: projection
+        }
+    }
+
+    Rectangle {
+        x: 100
+        y: 0
+        width: 40
+        height: 40
+        color: "#0000ff"
+    }
+
+    onEnterFinalStage: {
+        projection.matrix = Qt.matrix4x4(1, 0, 0, 0,
+                                         0, 1, 0, 0,
+                                         0, 0, 1, 0,
+                                         0, 0, 0, 2);
+        root.finalStageComplete = true;
+    }
+}
@@ -16,10 +16,12 @@
 #include <private/qopenglcontext_p.h>
 #endif
 
+#include <private/qquickwindow_p.h>
 #include <private/qsgcontext_p.h>
 #include <private/qsgrenderloop_p.h>
 #include <private/qsgrhisupport_p.h>
 #include <private/qsgplaintexture_p.h>
+#include <private/qsgrhiatlastexture_p.h>
 
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 #include <QtQuickTestUtils/private/visualtestutils_p.h>
@@ -74,6 +76,54 @@ private:
     QColor m_color;
 };
 
+// A horizontal line through the middle of the item, drawn as DrawLines geometry
+// of width 1. Its bounds have no height.
+class HorizontalLine : public QQuickItem
+{
+    Q_PROPERTY(QColor color READ color WRITE setColor NOTIFY colorChanged)
+    Q_OBJECT
+public:
+    HorizontalLine() {
+        setFlag(ItemHasContents);
+    }
+
+    void setColor(const QColor &c) {
+        if (c == m_color)
+            return;
+        m_color = c;
+        emit colorChanged(c);
+    }
+
+    QColor color() const { return m_color; }
+
+    QSGNode *updatePaintNode(QSGNode *node, UpdatePaintNodeData *) override
+    {
+        delete node;
+
+        QSGGeometry *geometry = new QSGGeometry(QSGGeometry::defaultAttributes_Point2D(), 2);
+        geometry->setDrawingMode(QSGGeometry::DrawLines);
+        geometry->setLineWidth(1);
+        const float y = float(height() / 2);
+        geometry->vertexDataAsPoint2D()[0].set(0, y);
+        geometry->vertexDataAsPoint2D()[1].set(float(width()), y);
+
+        QSGFlatColorMaterial *material = new QSGFlatColorMaterial;
+        material->setColor(m_color);
+
+        QSGGeometryNode *line = new QSGGeometryNode;
+        line->setGeometry(geometry);
+        line->setMaterial(material);
+        line->setFlags(QSGNode::OwnsGeometry | QSGNode::OwnsMaterial);
+        return line;
+    }
+
+Q_SIGNALS:
+    void colorChanged(const QColor &c);
+
+private:
+    QColor m_color;
+};
+
 class tst_SceneGraph : public QQmlDataTest
 {
     Q_OBJECT
@@ -89,11 +139,15 @@ private slots:
 
     void render_data();
     void render();
+    void frameReport();
+    void sharedGeometry();
+    void pipelineTrace();
 #if QT_CONFIG(opengl)
     void hideWithOtherContext();
 #endif
     void createTextureFromImage_data();
     void createTextureFromImage();
+    void atlasPages();
     void withAdoptedRhi();
     void resizeTextureFromImage();
 
@@ -115,6 +169,7 @@ tst_SceneGraph::tst_SceneGraph()
 void tst_SceneGraph::initTestCase()
 {
     qmlRegisterType<PerPixelRect>("SceneGraphTest", 1, 0, "PerPixelRect");
+    qmlRegisterType<HorizontalLine>("SceneGraphTest", 1, 0, "HorizontalLine");
 
     QQmlDataTest::initTestCase();
 
@@ -363,7 +418,12 @@ void tst_SceneGraph::render_data()
           << "render_bug37422.qml"
           << "render_OpacityThroughBatchRoot.qml"
           << "render_Mipmap.qml"
-          << "render_AlphaOverlapRebuild.qml";
+          << "render_AlphaOverlapRebuild.qml"
+          << "render_MoveInMergedBatch.qml"
+          << "render_OverlapManyElements.qml"
+          << "render_SharedGeometry.qml"
+          << "render_TransformInMergedBatch.qml"
+          << "render_OverlapManyElementsLine.qml";
 
     QRegularExpression sampleCount("#samples: *(\\d+)");
     //                          X:int   Y:int   R:float       G:float       B:float       Error:float
@@ -452,6 +512,157 @@ void tst_SceneGraph::render()
     }
 }
 
+void tst_SceneGraph::frameReport()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping frame report test due to not running with QRhi");
+
+    QQuickView view;
+    view.setSource(testFileUrl("render_MoveInMergedBatch.qml"));
+    view.setResizeMode(QQuickView::SizeViewToRootObject);
+    QQuickWindowPrivate *windowPrivate = QQuickWindowPrivate::get(&view);
+    windowPrivate->setFrameReportEnabled(true);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    // The four opaque rectangles end up in the same merged batch
+    view.grabWindow();
+    QSGRendererFrameReport report = windowPrivate->frameReport();
+    QCOMPARE(report.opaqueBatchCount, 1);
+    QCOMPARE(report.alphaBatchCount, 0);
+    QCOMPARE(report.mergedElementCount, 4);
+    QCOMPARE(report.unmergedElementCount, 0);
+    QCOMPARE(report.batches.size(), 1);
+    QCOMPARE(report.batches.first().elementCount, 4);
+    QVERIFY(report.batches.first().opaque);
+    QVERIFY(report.batches.first().merged);
+
+    // Nothing changed, so nothing should be rebuilt or uploaded
+    view.grabWindow();
+    report = windowPrivate->frameReport();
+    QCOMPARE(report.batches.size(), 1);
+    QVERIFY(!report.batches.first().rebuilt);
+    QCOMPARE(report.uploadedBytes, quint64(0));
+
+    // Moving one of the rectangles only uploads its vertices again
+    QQuickItem *moving = view.rootObject()->childItems().at(2);
+    moving->setY(100);
+    view.grabWindow();
+    report = windowPrivate->frameReport();
+    QCOMPARE(report.batches.size(), 1);
+    const QSGRendererFrameReport::Batch batch = report.batches.first();
+    QVERIFY(!batch.rebuilt);
+    QCOMPARE(batch.changes, QSGRendererFrameReport::Changes(QSGRendererFrameReport::TransformChanged));
+    QVERIFY(batch.uploadedBytes > 0);
+    QVERIFY(batch.uploadedBytes < batch.vertexCount * sizeof(QSGGeometry::ColoredPoint2D));
+    QVERIFY(report.pipelineChanges > 0);
+}
+
+void tst_SceneGraph::sharedGeometry()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping shared geometry test due to not running with QRhi");
+
+    QQuickView view;
+    view.setSource(testFileUrl("render_SharedGeometry.qml"));
+    view.setResizeMode(QQuickView::SizeViewToRootObject);
+    QQuickWindowPrivate *windowPrivate = QQuickWindowPrivate::get(&view);
+    windowPrivate->setFrameReportEnabled(true);
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+
+    QList<QQuickItem *> rotated;
+    for (QQuickItem *item : view.rootObject()->childItems()) {
+        if (item->rotation() != 0)
+            rotated.append(item);
+    }
+    QCOMPARE(rotated.size(), 3);
+
+    auto unmergedBatch = [](const QSGRendererFrameReport &report) {
+        for (const QSGRendererFrameReport::Batch &batch : report.batches) {
+            if (!batch.merged)
+                return batch;
+        }
+        return QSGRendererFrameReport::Batch();
+    };
+
+    // The rotated rectangles cannot be merged, but they have the same
+    // vertices, so these are only uploaded and bound once for all three.
+    // The background is drawn by a merged batch.
+    view.grabWindow();
+    QSGRendererFrameReport report = windowPrivate->frameReport();
+    QCOMPARE(report.unmergedElementCount, 3);
+    QSGRendererFrameReport::Batch batch = unmergedBatch(report);
+    QCOMPARE(batch.elementCount, 3);
+    QCOMPARE(batch.sharedGeometryCount, 2);
+    QCOMPARE(report.drawCalls, 4);
+    QCOMPARE(report.vertexInputChanges, 2);
+
+    // A different color gives the middle one different vertices
+    rotated.at(1)->setProperty("color", QColor(Qt::green));
+    view.grabWindow();
+    report = windowPrivate->frameReport();
+    batch = unmergedBatch(report);
+    QCOMPARE(batch.elementCount, 3);
+    QCOMPARE(batch.sharedGeometryCount, 0);
+    QCOMPARE(report.drawCalls, 4);
+    QCOMPARE(report.vertexInputChanges, 4);
+}
+
+void tst_SceneGraph::pipelineTrace()
+{
+    if (!isRunningOnRhi())
+        QSKIP("Skipping pipeline trace test due to not running with QRhi");
+
+    QTemporaryDir dir;
+    QVERIFY(dir.isValid());
+    const QString traceFile = dir.filePath(QLatin1String("pipelines.trace"));
+
+    // Record the pipelines used by the scene. The trace is written when the
+    // scenegraph is invalidated.
+    QImage recorded;
+    int recordedPipelines = 0;
+    qputenv("QSG_RHI_PIPELINE_TRACE_SAVE", QFile::encodeName(traceFile));
+    {
+        QQuickView view;
+        view.setSource(testFileUrl("render_MoveInMergedBatch.qml"));
+        view.setResizeMode(QQuickView::SizeViewToRootObject);
+        QQuickWindowPrivate *windowPrivate = QQuickWindowPrivate::get(&view);
+        windowPrivate->setFrameReportEnabled(true);
+        view.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&view));
+        recorded = view.grabWindow();
+
+        const QSGRendererFrameReport report = windowPrivate->frameReport();
+        QCOMPARE(report.pipelinesWarmedUp, 0);
+        QCOMPARE(report.warmedUpPipelinesTaken, 0);
+        QVERIFY(report.pipelinesCreated > 0);
+        recordedPipelines = report.pipelinesCreated;
+    }
+    qunsetenv("QSG_RHI_PIPELINE_TRACE_SAVE");
+    QTRY_VERIFY(QFileInfo(traceFile).size() > 0);
+
+    // Rendering with the pipelines created up front from the trace gives the
+    // same result, without creating any pipeline while preparing the frames.
+    qputenv("QSG_RHI_PIPELINE_TRACE_LOAD", QFile::encodeName(traceFile));
+    {
+        QQuickView view;
+        view.setSource(testFileUrl("render_MoveInMergedBatch.qml"));
+        view.setResizeMode(QQuickView::SizeViewToRootObject);
+        QQuickWindowPrivate *windowPrivate = QQuickWindowPrivate::get(&view);
+        windowPrivate->setFrameReportEnabled(true);
+        view.show();
+        QVERIFY(QTest::qWaitForWindowExposed(&view));
+        QCOMPARE(view.grabWindow(), recorded);
+
+        const QSGRendererFrameReport report = windowPrivate->frameReport();
+        QVERIFY(report.pipelinesWarmedUp >= recordedPipelines);
+        QCOMPARE(report.warmedUpPipelinesTaken, recordedPipelines);
+        QCOMPARE(report.pipelinesCreated, 0);
+    }
+    qunsetenv("QSG_RHI_PIPELINE_TRACE_LOAD");
+}
+
 #if QT_CONFIG(opengl)
 // Testcase for QTBUG-34898. We make another context current on another surface
 // in the GUI thread and hide the QQuickWindow while the other context is
@@ -527,6 +738,60 @@ void tst_SceneGraph::createTextureFromImage()
     QCOMPARE(texture->hasAlphaChannel(), expectedAlpha);
 }
 
+void tst_SceneGraph::atlasPages()
+{
+    // Use the smallest atlas size, regardless of the size of the screen
+    qputenv("QSG_ATLAS_WIDTH", "512");
+    qputenv("QSG_ATLAS_HEIGHT", "512");
+    const auto restoreAtlasSize = qScopeGuard([] {
+        qunsetenv("QSG_ATLAS_WIDTH");
+        qunsetenv("QSG_ATLAS_HEIGHT");
+    });
+
+    QQuickView view;
+    view.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&view));
+    QTRY_VERIFY(view.isSceneGraphInitialized());
+
+    // Small enough to be atlased, but an atlas only has room for four of them
+    QImage image(250, 250, QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::red);
+
+    std::vector<std::unique_ptr<QSGTexture>> textures;
+    for (int i = 0; i < 12; ++i)
+        textures.emplace_back(view.createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas));
+    if (!textures.front()->isAtlasTexture())
+        QSKIP("The scenegraph backend does not use a texture atlas");
+
+    // When an atlas is full, the textures go into a new one, instead of
+    // not being atlased at all.
+    QList<QPointer<QSGRhiAtlasTexture::AtlasBase>> atlases;
+    for (const auto &texture : textures) {
+        QVERIFY(texture->isAtlasTexture());
+        QSGRhiAtlasTexture::AtlasBase *atlas
+                = static_cast<QSGRhiAtlasTexture::TextureBase *>(texture.get())->atlas();
+        if (!atlases.contains(atlas))
+            atlases.append(atlas);
+    }
+    QVERIFY(atlases.size() > 1);
+
+    // Once all textures are released, the atlases are freed, except for
+    // one, which is reused for the next texture.
+    textures.clear();
+    textures.emplace_back(view.createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas));
+    QVERIFY(textures.front()->isAtlasTexture());
+    QSGRhiAtlasTexture::AtlasBase *reused
+            = static_cast<QSGRhiAtlasTexture::TextureBase *>(textures.front().get())->atlas();
+    QVERIFY(atlases.contains(reused));
+    QTRY_COMPARE(atlases.count(nullptr), atlases.size() - 1);
+
+    // The space of released textures can be used again
+    for (int i = 1; i < 12; ++i)
+        textures.emplace_back(view.createTextureFromImage(image, QQuickWindow::TextureCanUseAtlas));
+    for (const auto &texture : textures)
+        QVERIFY(texture->isAtlasTexture());
+}
+
 #if QT_CONFIG(vulkan)
 static QVulkanInstance *TestOffscreenScene_vkinst = nullptr;
 #endif
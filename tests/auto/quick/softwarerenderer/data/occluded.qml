@@ -0,0 +1,28 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick
+
+Item {
+    width: 100
+    height: 100
+
+    property color hiddenColor: "red"
+
+    Rectangle {
+        x: 20
+        y: 20
+        width: 60
+        height: 60
+        color: hiddenColor
+    }
+
+    // Not opaque as a whole, because of its corners and border
+    Rectangle {
+        anchors.fill: parent
+        radius: 10
+        border.width: 2
+        border.color: "#80000000"
+        color: "white"
+    }
+}
@@ -0,0 +1,32 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick
+
+Item {
+    width: 200
+    height: 200
+
+    Rectangle {
+        anchors.fill: parent
+        gradient: Gradient {
+            GradientStop { position: 0.0; color: "steelblue" }
+            GradientStop { position: 1.0; color: "darkorange" }
+        }
+    }
+
+    Repeater {
+        model: 20
+        Rectangle {
+            x: 5 + (index % 5) * 38
+            y: 5 + Math.floor(index / 5) * 47.5
+            width: 45
+            height: 41.5
+            radius: index % 3 * 6
+            border.width: index % 2 ? 3 : 0
+            border.color: "black"
+            color: Qt.rgba(index / 20, 1 - index / 20, 0.5, 0.6)
+            antialiasing: true
+        }
+    }
+}
@@ -6,6 +6,8 @@
 #include <QGuiApplication>
 
 #include <private/qsgrenderloop_p.h>
+#include <private/qquickwindow_p.h>
+#include <private/qsgsoftwarerenderer_p.h>
 
 #include <QtQuickTestUtils/private/qmlutils_p.h>
 #include <QtQuickTestUtils/private/viewtestutils_p.h>
@@ -22,6 +24,8 @@ private slots:
     void initTestCase() override;
 
     void renderTarget();
+    void parallelRendering();
+    void occludedNodes();
 };
 
 tst_SoftwareRenderer::tst_SoftwareRenderer()
@@ -93,6 +97,92 @@ void tst_SoftwareRenderer::renderTarget()
              qPrintable(errorMessage));
 }
 
+static QImage renderToImage(const QUrl &url)
+{
+    QQuickRenderControl rc;
+    QScopedPointer<QQuickWindow> window(new QQuickWindow(&rc));
+    window->resize(200, 200);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, url);
+    QScopedPointer<QQuickItem> item(qobject_cast<QQuickItem *>(component.create()));
+    if (!item)
+        return QImage();
+    item->setParentItem(window->contentItem());
+
+    QImage renderTarget(window->size(), QImage::Format_ARGB32_Premultiplied);
+    renderTarget.fill(Qt::transparent);
+    window->setRenderTarget(QQuickRenderTarget::fromPaintDevice(&renderTarget));
+
+    rc.polishItems();
+    rc.beginFrame();
+    rc.sync();
+    rc.render();
+    rc.endFrame();
+
+    item.reset();
+    return renderTarget;
+}
+
+void tst_SoftwareRenderer::parallelRendering()
+{
+    if (QQuickWindow::sceneGraphBackend() != "software")
+        QSKIP("Skipping complex rendering tests due to not running with software");
+
+    // Painting the window in bands on several threads must give exactly
+    // the same result as painting it on the render thread only.
+    qputenv("QSG_SOFTWARE_RENDERER_PARALLEL_THRESHOLD", "0");
+    const QImage sequential = renderToImage(testFileUrl("parallel.qml"));
+    qputenv("QSG_SOFTWARE_RENDERER_PARALLEL_THRESHOLD", "1");
+    const QImage parallel = renderToImage(testFileUrl("parallel.qml"));
+    qunsetenv("QSG_SOFTWARE_RENDERER_PARALLEL_THRESHOLD");
+
+    QVERIFY(!sequential.isNull());
+    QCOMPARE(parallel, sequential);
+}
+
+void tst_SoftwareRenderer::occludedNodes()
+{
+    if (QQuickWindow::sceneGraphBackend() != "software")
+        QSKIP("Skipping complex rendering tests due to not running with software");
+
+    QQuickRenderControl rc;
+    QScopedPointer<QQuickWindow> window(new QQuickWindow(&rc));
+    window->resize(100, 100);
+
+    QQmlEngine engine;
+    QQmlComponent component(&engine, testFileUrl("occluded.qml"));
+    QScopedPointer<QQuickItem> item(qobject_cast<QQuickItem *>(component.create()));
+    QVERIFY(item);
+    item->setParentItem(window->contentItem());
+
+    QImage renderTarget(window->size(), QImage::Format_ARGB32_Premultiplied);
+    window->setRenderTarget(QQuickRenderTarget::fromPaintDevice(&renderTarget));
+
+    auto renderFrame = [&rc]() {
+        rc.polishItems();
+        rc.beginFrame();
+        rc.sync();
+        rc.render();
+        rc.endFrame();
+    };
+
+    renderFrame();
+    auto renderer = static_cast<QSGSoftwareRenderer *>(QQuickWindowPrivate::get(window.data())->renderer);
+    QVERIFY(renderer);
+    QVERIFY(!renderer->flushRegion().isEmpty());
+    QCOMPARE(renderTarget.pixelColor(50, 50), QColor(Qt::white));
+
+    // The changed rectangle is hidden by the inside of the rounded
+    // rectangle above it, so nothing needs to be painted.
+    item->setProperty("hiddenColor", QColor(Qt::blue));
+    renderFrame();
+    QVERIFY(renderer->flushRegion().isEmpty());
+    QCOMPARE(renderTarget.pixelColor(50, 50), QColor(Qt::white));
+
+    item.reset();
+}
+
 #include "tst_softwarerenderer.moc"
 
 QTEST_MAIN(tst_SoftwareRenderer)
@@ -6,6 +6,7 @@
 #include <QDebug>
 
 #include <private/qqmlchangeset_p.h>
+#include <private/qqmllistcompositor_p.h>
 
 class tst_qqmlchangeset : public QObject
 {
@@ -13,6 +14,11 @@ class tst_qqmlchangeset : public QObject
 
 private slots:
     void move();
+    void compositorFind_data();
+    void compositorFind();
+    void compositorSetFlags();
+    void compositorChurn_data();
+    void compositorChurn();
 };
 
 void tst_qqmlchangeset::move()
@@ -26,5 +32,96 @@ void tst_qqmlchangeset::move()
     }
 }
 
+static const QQmlListCompositor::Group Visible = QQmlListCompositor::Group(2);
+
+// Builds a compositor with a visible group of every other item, so that each item is a range.
+static void populateFragmented(QQmlListCompositor *compositor, void *list, int count)
+{
+    compositor->setGroupCount(3);
+    for (int i = 0; i < count; ++i) {
+        compositor->append(list, i, 1, QQmlListCompositor::DefaultFlag
+                           | (i % 2 ? 0 : (1 << Visible)));
+    }
+}
+
+void tst_qqmlchangeset::compositorFind_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("10000") << 10000;
+}
+
+void tst_qqmlchangeset::compositorFind()
+{
+    QFETCH(int, count);
+
+    int list;
+    QQmlListCompositor compositor;
+    populateFragmented(&compositor, &list, count);
+
+    const int visibleCount = compositor.count(Visible);
+    QBENCHMARK {
+        for (int i = 0; i < visibleCount; ++i)
+            compositor.find(Visible, (i * 7919) % visibleCount);
+    }
+}
+
+void tst_qqmlchangeset::compositorSetFlags()
+{
+    const int count = 10000;
+
+    QBENCHMARK {
+        int list;
+        QQmlListCompositor compositor;
+        populateFragmented(&compositor, &list, count);
+        for (int i = 1; i < count; i += 2)
+            compositor.setFlags(QQmlListCompositor::Default, i, 1, 1 << Visible);
+    }
+}
+
+void tst_qqmlchangeset::compositorChurn_data()
+{
+    QTest::addColumn<bool>("indexed");
+
+    QTest::newRow("walk") << false;
+    QTest::newRow("indexed") << true;
+}
+
+void tst_qqmlchangeset::compositorChurn()
+{
+    // Alternates changing the flags of an item with lookups of items far away from it.
+    // The walk row looks the items up by walking the ranges from the changed item,
+    // like find() does without a range index, for comparison.
+    QFETCH(bool, indexed);
+    const int count = 10000;
+
+    QBENCHMARK {
+        int list;
+        QQmlListCompositor compositor;
+        populateFragmented(&compositor, &list, count);
+        for (int i = 0; i < 1000; ++i) {
+            const int changed = (i * 7919) % count;
+            if (i % 2)
+                compositor.clearFlags(QQmlListCompositor::Default, changed, 1, 1 << Visible);
+            else
+                compositor.setFlags(QQmlListCompositor::Default, changed, 1, 1 << Visible);
+
+            const int visibleCount = compositor.count(Visible);
+            for (int j = 1; j <= 4; ++j) {
+                const int index = (changed / 2 + j * visibleCount / 5) % visibleCount;
+                if (indexed) {
+                    compositor.find(Visible, index);
+                } else {
+                    QQmlListCompositor::iterator it
+                            = compositor.find(QQmlListCompositor::Default, changed);
+                    it.setGroup(Visible);
+                    it += index - it.index[Visible];
+                }
+            }
+        }
+    }
+}
+
 QTEST_MAIN(tst_qqmlchangeset)
 #include "tst_qqmlchangeset.moc"
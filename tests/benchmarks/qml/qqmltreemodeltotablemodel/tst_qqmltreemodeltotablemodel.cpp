@@ -0,0 +1,131 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <qtest.h>
+
+#include <QtQmlModels/private/qqmltreemodeltotablemodel_p_p.h>
+
+// 1000 top level rows with 1000 children each. Fully expanded, that's 1001000 rows.
+class WideTreeModel : public QAbstractItemModel
+{
+public:
+    static constexpr int TopLevelCount = 1000;
+    static constexpr int ChildCount = 1000;
+
+    QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const override
+    {
+        if (!hasIndex(row, column, parent))
+            return QModelIndex();
+        return createIndex(row, column, parent.isValid() ? quintptr(parent.row() + 1) : 0);
+    }
+
+    QModelIndex parent(const QModelIndex &child) const override
+    {
+        if (!child.isValid() || child.internalId() == 0)
+            return QModelIndex();
+        return createIndex(int(child.internalId() - 1), 0, quintptr(0));
+    }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const override
+    {
+        if (!parent.isValid())
+            return TopLevelCount;
+        return (parent.internalId() == 0 && parent.column() == 0) ? ChildCount : 0;
+    }
+
+    int columnCount(const QModelIndex & = QModelIndex()) const override { return 1; }
+
+    QVariant data(const QModelIndex &index, int role) const override
+    {
+        if (role != Qt::DisplayRole)
+            return QVariant();
+        return index.row();
+    }
+
+    void changeData(int topLevelRow, int childRow)
+    {
+        const QModelIndex child = index(childRow, 0, index(topLevelRow, 0));
+        emit dataChanged(child, child);
+    }
+};
+
+class tst_qqmltreemodeltotablemodel : public QObject
+{
+    Q_OBJECT
+
+private slots:
+    void expandAll();
+    void mapFromModel();
+    void dataChanged();
+    void collapseAndExpand();
+
+private:
+    static void expandAll(QQmlTreeModelToTableModel *model, WideTreeModel *treeModel);
+};
+
+void tst_qqmltreemodeltotablemodel::expandAll(QQmlTreeModelToTableModel *model,
+                                              WideTreeModel *treeModel)
+{
+    for (int row = WideTreeModel::TopLevelCount - 1; row >= 0; --row)
+        model->expand(treeModel->index(row, 0));
+}
+
+void tst_qqmltreemodeltotablemodel::expandAll()
+{
+    QBENCHMARK_ONCE {
+        WideTreeModel treeModel;
+        QQmlTreeModelToTableModel model;
+        model.setModel(&treeModel);
+        expandAll(&model, &treeModel);
+        QCOMPARE(model.rowCount(), WideTreeModel::TopLevelCount * (WideTreeModel::ChildCount + 1));
+    }
+}
+
+void tst_qqmltreemodeltotablemodel::mapFromModel()
+{
+    WideTreeModel treeModel;
+    QQmlTreeModelToTableModel model;
+    model.setModel(&treeModel);
+    expandAll(&model, &treeModel);
+
+    QBENCHMARK {
+        // Alternate between both ends of the table.
+        for (int i = 0; i < 100; ++i) {
+            const int topLevelRow = (i % 2) ? i : WideTreeModel::TopLevelCount - 1 - i;
+            const QModelIndex child = treeModel.index(i, 0, treeModel.index(topLevelRow, 0));
+            QVERIFY(model.mapFromModel(child).isValid());
+        }
+    }
+}
+
+void tst_qqmltreemodeltotablemodel::dataChanged()
+{
+    WideTreeModel treeModel;
+    QQmlTreeModelToTableModel model;
+    model.setModel(&treeModel);
+    expandAll(&model, &treeModel);
+
+    QBENCHMARK {
+        for (int i = 0; i < 100; ++i)
+            treeModel.changeData((i * 397) % WideTreeModel::TopLevelCount, i);
+    }
+}
+
+void tst_qqmltreemodeltotablemodel::collapseAndExpand()
+{
+    WideTreeModel treeModel;
+    QQmlTreeModelToTableModel model;
+    model.setModel(&treeModel);
+    expandAll(&model, &treeModel);
+
+    QBENCHMARK {
+        for (int i = 0; i < 10; ++i) {
+            const QModelIndex index = treeModel.index((i * 97) % WideTreeModel::TopLevelCount, 0);
+            model.collapse(index);
+            model.expand(index);
+        }
+    }
+}
+
+QTEST_MAIN(tst_qqmltreemodeltotablemodel)
+#include "tst_qqmltreemodeltotablemodel.moc"
@@ -0,0 +1,35 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick
+
+Item {
+    id: root
+    width: 400
+    height: 400
+
+    property int count: 0
+    property bool toggle: false
+
+    Repeater {
+        model: root.count
+        // Alternating opacities stop neighbours from being merged into one
+        // batch, so every batch has to be checked for overlaps.
+        Rectangle {
+            x: (index % 100) * 4
+            y: Math.floor(index / 100) * 4
+            width: 6
+            height: 6
+            opacity: index % 2 ? 0.5 : 0.6
+            color: "red"
+        }
+    }
+
+    // Adding and removing a node rebuilds the render lists and batches
+    Rectangle {
+        visible: root.toggle
+        width: 10
+        height: 10
+        color: "#80000000"
+    }
+}
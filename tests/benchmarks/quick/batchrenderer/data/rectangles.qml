@@ -0,0 +1,28 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+import QtQuick
+
+Item {
+    id: root
+    width: 400
+    height: 400
+
+    property int count: 0
+    property bool rotate: false
+    property real offset: 0
+    property int movingIndex: -1
+
+    Repeater {
+        model: root.count
+        Rectangle {
+            readonly property bool moving: root.movingIndex < 0 || root.movingIndex === index
+            x: (index % 100) * 4 + (moving && !root.rotate ? root.offset : 0)
+            y: Math.floor(index / 100) * 4
+            width: 3
+            height: 3
+            rotation: moving && root.rotate ? root.offset : 0
+            color: index % 2 ? "red" : "blue"
+        }
+    }
+}
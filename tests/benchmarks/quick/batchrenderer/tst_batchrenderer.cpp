@@ -0,0 +1,159 @@
+// Copyright (C) 2022 The Qt Company Ltd.
+// SPDX-License-Identifier: LicenseRef-Qt-Commercial OR GPL-3.0-only WITH Qt-GPL-exception-1.0
+
+#include <qtest.h>
+#include <QtQuick/QQuickView>
+#include <QtQuick/QQuickItem>
+#include <QtQuick/QSGRendererInterface>
+#include <QtQuickTestUtils/private/qmlutils_p.h>
+
+class tst_batchrenderer : public QQmlDataTest
+{
+    Q_OBJECT
+
+public:
+    tst_batchrenderer();
+
+private slots:
+    void initTestCase() override;
+    void uploadMergedBatch_data();
+    void uploadMergedBatch();
+    void moveOneInMergedBatch();
+    void prepareAlphaBatches_data();
+    void prepareAlphaBatches();
+    void uploadUnmergedBatch_data();
+    void uploadUnmergedBatch();
+};
+
+tst_batchrenderer::tst_batchrenderer()
+    : QQmlDataTest(QT_QMLTEST_DATADIR)
+{
+}
+
+void tst_batchrenderer::initTestCase()
+{
+    QQmlDataTest::initTestCase();
+    // Measure the renderer, not the graphics driver
+    QQuickWindow::setGraphicsApi(QSGRendererInterface::Null);
+}
+
+void tst_batchrenderer::uploadMergedBatch_data()
+{
+    QTest::addColumn<int>("count");
+    QTest::addColumn<bool>("rotate");
+
+    QTest::newRow("1000, translate") << 1000 << false;
+    QTest::newRow("1000, rotate") << 1000 << true;
+    QTest::newRow("10000, translate") << 10000 << false;
+    QTest::newRow("10000, rotate") << 10000 << true;
+}
+
+void tst_batchrenderer::uploadMergedBatch()
+{
+    // Move all the rectangles every frame, so that the merged
+    // batch they are rendered in needs to be uploaded again.
+    QFETCH(int, count);
+    QFETCH(bool, rotate);
+
+    QQuickView window;
+    window.setSource(testFileUrl("rectangles.qml"));
+    QQuickItem *root = window.rootObject();
+    QVERIFY(root);
+    root->setProperty("count", count);
+    root->setProperty("rotate", rotate);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    qreal offset = 0;
+    QBENCHMARK {
+        offset += 1;
+        root->setProperty("offset", offset);
+        window.grabWindow();
+    }
+}
+
+void tst_batchrenderer::moveOneInMergedBatch()
+{
+    // Move a single rectangle every frame. Only its vertices should
+    // need to be uploaded, not those of the whole merged batch.
+    QQuickView window;
+    window.setSource(testFileUrl("rectangles.qml"));
+    QQuickItem *root = window.rootObject();
+    QVERIFY(root);
+    root->setProperty("count", 10000);
+    root->setProperty("movingIndex", 5000);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    qreal offset = 0;
+    QBENCHMARK {
+        offset += 1;
+        root->setProperty("offset", offset);
+        window.grabWindow();
+    }
+}
+
+void tst_batchrenderer::prepareAlphaBatches_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("100") << 100;
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("5000") << 5000;
+}
+
+void tst_batchrenderer::prepareAlphaBatches()
+{
+    // Rebuild the batches of many overlapping, semi-transparent
+    // rectangles that cannot be merged with their neighbours.
+    QFETCH(int, count);
+
+    QQuickView window;
+    window.setSource(testFileUrl("alpharectangles.qml"));
+    QQuickItem *root = window.rootObject();
+    QVERIFY(root);
+    root->setProperty("count", count);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    bool toggle = false;
+    QBENCHMARK {
+        toggle = !toggle;
+        root->setProperty("toggle", toggle);
+        window.grabWindow();
+    }
+}
+
+void tst_batchrenderer::uploadUnmergedBatch_data()
+{
+    QTest::addColumn<int>("count");
+
+    QTest::newRow("1000") << 1000;
+    QTest::newRow("10000") << 10000;
+}
+
+void tst_batchrenderer::uploadUnmergedBatch()
+{
+    // Rebuild and upload the batches of many identical shapes that
+    // cannot be merged, and so are drawn one by one.
+    QFETCH(int, count);
+
+    QQuickView window;
+    window.setSource(testFileUrl("markers.qml"));
+    QQuickItem *root = window.rootObject();
+    QVERIFY(root);
+    root->setProperty("count", count);
+    window.show();
+    QVERIFY(QTest::qWaitForWindowExposed(&window));
+
+    bool toggle = false;
+    QBENCHMARK {
+        toggle = !toggle;
+        root->setProperty("toggle", toggle);
+        window.grabWindow();
+    }
+}
+
+QTEST_MAIN(tst_batchrenderer)
+
+#include "tst_batchrenderer.moc"